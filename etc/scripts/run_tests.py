@@ -32,78 +32,283 @@
 
 
 import xml.etree.ElementTree as ET
+import hashlib
+import json
+import re
 import sys
-from subprocess import check_output, TimeoutExpired, CalledProcessError, STDOUT
+from subprocess import check_output, CalledProcessError, DEVNULL, Popen, \
+    TimeoutExpired
 from argparse import ArgumentParser
-from os import linesep, path
-from shutil import rmtree
+from collections import OrderedDict
+from glob import glob
+from os import linesep, makedirs, path
+from shutil import disk_usage, rmtree, which
 from pathlib import Path
+from tempfile import TemporaryDirectory
+from time import sleep, time
 
 
-def get_testdir_from_xml(binary_path):
-    '''Acquire test directory from provided config.xml file.'''
+EVENTS_POLL_INTERVAL = 0.5  # seconds
+WORKERS_POLL_INTERVAL = 0.1  # seconds
+EXCLUSIVE = 'exclusive'
+DEFAULT_DURATION_MS = 1000  # estimate of a new test when history is empty
+HISTORY_SMOOTHING = 0.5  # weight of the latest duration in history
+WATCHDOG_EXIT_CODE = 124  # binary exit code when test exceeds --test-timeout
+
+
+def get_testdirs_from_xml(binary_path):
+    '''Acquire test directories from provided config.xml file.'''
     config_path = path.join(path.dirname(binary_path), 'config.xml')
     root = ET.parse(config_path).getroot()
     testdir_xpath = 'localConfiguration/testDir'
-    elem = root.find(testdir_xpath)
-    if elem is None:
+    elems = root.findall(testdir_xpath)
+    if not elems:
         sys.exit('config.xml file invalid.'
                  ' Element {}/{} not found.'.format(root.tag, testdir_xpath))
-    workdir = elem.text
-    return path.join(workdir, 'pmdk_tests')
-
-
-def gtest_filter_rest(last_ran_test, all_tests, excluded):
-    '''Prepare gtest_filter argument that filters out tests already executed \
-    as well as excluded by user.'''
-    gtest_filter = '--gtest_filter=-'
-    already_ran = all_tests[:all_tests.index(last_ran_test) + 1]
+    return [path.join(elem.text, 'pmdk_tests') for elem in elems]
 
-    for test in already_ran:
-        gtest_filter = gtest_filter + '*.{}:'.format(test)
-    if excluded:
-        gtest_filter = gtest_filter + excluded
-    return gtest_filter
 
-
-def get_last_ran_test(output):
-    '''Get last executed test from test binary execution output.'''
-    for line in reversed(output.splitlines()):
-        if '[ RUN      ]' in line:
-            return line.split('.')[1].strip()
-    return None
-
-
-def get_fails(output):
-    '''Get failed tests from test binary execution output.'''
-    return [line.replace('[  FAILED  ]', '').split('(')[0].strip()
-            for line in output.splitlines()
-            if '[  FAILED  ]' in line and line.strip().endswith(')')]
+def remove_testdirs(testdirs):
+    '''Remove test directories left by terminated test binary.'''
+    for testdir in testdirs:
+        rmtree(testdir, ignore_errors=True)
 
 
-def execute(cmd, timeout, testdir):
-    '''Execute command, handle timeout, return output and exit code.'''
+class DurationHistory:
+    '''Durations of tests from previous runs, stored in JSON file. Duration \
+    of each test is averaged over runs with exponential smoothing. Tests \
+    without history are estimated with median of durations loaded from the \
+    file.'''
+
+    def __init__(self, history_path):
+        self.history_path = history_path
+        self.durations = {}
+        try:
+            with open(history_path) as history_file:
+                self.durations = json.load(history_file)
+        except (OSError, ValueError):
+            pass
+        self.median = DEFAULT_DURATION_MS
+        if self.durations:
+            known = sorted(self.durations.values())
+            self.median = known[len(known) // 2]
+
+    def estimate(self, test):
+        return self.durations.get(test, self.median)
+
+    def record(self, test, duration_ms):
+        if test in self.durations:
+            duration_ms = HISTORY_SMOOTHING * duration_ms +\
+                (1 - HISTORY_SMOOTHING) * self.durations[test]
+        self.durations[test] = duration_ms
+
+    def longest_first(self, tests):
+        '''Return tests ordered by estimated duration, longest first.'''
+        return sorted(tests, key=self.estimate, reverse=True)
+
+    def save(self):
+        try:
+            with open(self.history_path, 'w') as history_file:
+                json.dump(self.durations, history_file, indent=1,
+                          sort_keys=True)
+        except OSError as error:
+            print('Unable to save test durations: {}'.format(error))
+
+
+def hash_file(file_path):
+    '''Return SHA-256 hex digest of file content.'''
+    digest = hashlib.sha256()
+    with open(file_path, 'rb') as hashed_file:
+        for block in iter(lambda: hashed_file.read(1 << 20), b''):
+            digest.update(block)
+    return digest.hexdigest()
+
+
+def get_pmdk_files(binary):
+    '''Return paths of pmempool tool and libpmem* libraries used by it and \
+    by test binary.'''
+    pmempool = which('pmempool')
+    files = [pmempool] if pmempool else []
     try:
-        out = check_output(cmd, timeout=timeout, stderr=STDOUT).decode('utf-8')
-    except TimeoutExpired as e:
-        print(e.output.decode('utf-8'))
-        rmtree(testdir, ignore_errors=True)
-        sys.exit('Execution timed out.')
-    except CalledProcessError as e:
-        out = e.output.decode('utf-8')
-        print(out)
-        return out, e.returncode
-    else:
-        print(out)
-        return out, 0
+        for linked in [binary] + files:
+            ldd_out = check_output(['ldd', linked],
+                                   stderr=DEVNULL).decode('utf-8')
+            files.extend(re.findall(r'libpmem\S* => (\S+)', ldd_out))
+    except (OSError, CalledProcessError):
+        # no ldd (Windows), libraries are placed next to the tool
+        if pmempool:
+            files.extend(glob(path.join(path.dirname(pmempool),
+                                        'libpmem*.dll')))
+    return sorted(set(files))
+
+
+def get_filesystem(directory):
+    '''Return type and mount options of file system containing directory, \
+    or 'unknown' where /proc/mounts is not available.'''
+    directory = path.realpath(directory)
+    filesystem = 'unknown'
+    mount_point = ''
+    try:
+        with open('/proc/mounts') as mounts:
+            for line in mounts:
+                fields = line.split()
+                if len(fields) < 4:
+                    continue
+                if (directory == fields[1] or directory.startswith(
+                        fields[1].rstrip('/') + '/')) and\
+                        len(fields[1]) >= len(mount_point):
+                    mount_point = fields[1]
+                    filesystem = '{} {}'.format(fields[2], fields[3])
+    except OSError:
+        pass
+    return filesystem
+
+
+class ResultCache:
+    '''Passed results of tests stored in cache directory. Result of a test \
+    is reused only if test binary, pmempool tool and libpmem* libraries, \
+    binary options, parameters of the test (as printed by gtest) and file \
+    system of test directory are the same as when it was recorded.'''
+
+    def __init__(self, cache_dir, binary, binary_args, testdir, params):
+        self.results_path = path.join(cache_dir, 'results.json')
+        self.params = params
+        self.results = {}
+        try:
+            with open(self.results_path) as results_file:
+                self.results = json.load(results_file)
+        except (OSError, ValueError):
+            pass
+
+        environment = hashlib.sha256()
+        for hashed_file in [binary] + get_pmdk_files(binary):
+            environment.update(hash_file(hashed_file).encode('utf-8'))
+        environment.update(' '.join(binary_args).encode('utf-8'))
+        environment.update(get_filesystem(testdir).encode('utf-8'))
+        self.environment = environment.hexdigest()
+
+    def key(self, test):
+        key = hashlib.sha256(self.environment.encode('utf-8'))
+        key.update('{}\n{}'.format(test, self.params.get(test, ''))
+                   .encode('utf-8'))
+        return key.hexdigest()
+
+    def passed_tests(self):
+        '''Return tests which passed in the same environment before.'''
+        return [test for test in self.params if self.key(test) in self.results]
+
+    def record(self, test, result):
+        if result == 'passed':
+            self.results[self.key(test)] = test
+
+    def save(self):
+        try:
+            makedirs(path.dirname(self.results_path), exist_ok=True)
+            with open(self.results_path, 'w') as results_file:
+                json.dump(self.results, results_file, indent=1,
+                          sort_keys=True)
+        except OSError as error:
+            print('Unable to save result cache: {}'.format(error))
+
+
+class TestEvents:
+    '''Consume structured test events streamed by test binary to events \
+    file. Events are read incrementally, only the part of the file appended \
+    since the previous read is processed.'''
+
+    def __init__(self, events_path, tests_count, history, cache):
+        self.events_path = events_path
+        self.tests_count = tests_count
+        self.history = history
+        self.cache = cache
+        self.position = 0
+        self.partial = b''
+        self.finished = 0
+        self.failed = []
+        self.crashed = []
+        self.running = None
+        self.last_started = None
+
+    def consume(self):
+        '''Process events appended to events file since the last call.'''
+        try:
+            with open(self.events_path, 'rb') as events_file:
+                events_file.seek(self.position)
+                data = events_file.read()
+                self.position = events_file.tell()
+        except FileNotFoundError:
+            return
+
+        lines = (self.partial + data).split(b'\n')
+        self.partial = lines.pop()
+        for line in lines:
+            if line:
+                self.handle(json.loads(line.decode('utf-8')))
+
+    def handle(self, event):
+        '''Update execution state with single event.'''
+        if event['event'] == 'start':
+            self.running = event['test']
+            self.last_started = event['test']
+        elif event['event'] == 'end':
+            self.running = None
+            self.finished += 1
+            if event['result'] == 'failed':
+                self.failed.append(event['test'])
+            elif event['result'] == 'crashed':
+                self.crashed.append(event['test'])
+            self.history.record(event['test'], event['duration_ms'])
+            if self.cache:
+                self.cache.record(event['test'], event['result'])
+            print('[{}/{}] {} {} ({} ms)'.format(
+                self.finished, self.tests_count, event['test'],
+                event['result'], event['duration_ms']))
+
+
+def execute(cmd, timeout, testdirs, events):
+    '''Execute command, consume test events while it runs, handle timeout, \
+    return exit code.'''
+    deadline = time() + timeout if timeout else None
+    process = Popen(cmd + ['--events-file={}'.format(events.events_path)])
+
+    while True:
+        try:
+            returncode = process.wait(timeout=EVENTS_POLL_INTERVAL)
+        except TimeoutExpired:
+            events.consume()
+            if deadline and time() > deadline:
+                process.kill()
+                process.wait()
+                remove_testdirs(testdirs)
+                sys.exit('Execution timed out.')
+        else:
+            events.consume()
+            return returncode
+
+
+def list_tests(cmd):
+    '''Call --gtest_list_tests on test binary and get all tests to be run \
+    along with their parameters as printed by gtest.'''
+    list_tests_out = check_output(cmd + ['--gtest_list_tests']).decode('utf-8')
+    tests = OrderedDict()
+    test_case = ''
+    for line in list_tests_out.splitlines():
+        name, _, params = line.partition('#')
+        name = name.strip()
+        if not name:
+            continue
+        if line.startswith(' '):
+            if 'DISABLED_' not in test_case + name:
+                tests[test_case + name] = params.strip()
+        else:
+            test_case = name
+
+    return tests
 
 
 def get_all_tests_to_run(cmd):
     '''Call --gtest_list_tests on test binary and get all tests to be run.'''
-    list_tests_out = check_output(cmd + ['--gtest_list_tests']).decode('utf-8')
-    all_tests = [line.split('#')[0].strip()
-                 for line in list_tests_out.splitlines()
-                 if '#' in line or not line.endswith('.')]
+    all_tests = list(list_tests(cmd))
 
     if not all_tests:
         sys.exit('No tests to run from {}.'.format(" ".join(cmd)))
@@ -111,13 +316,148 @@ def get_all_tests_to_run(cmd):
     return all_tests
 
 
-def last_test_terminated(out, returncode):
-    """Last executed test terminated if in unsuccessful execution the last \
-    '[ RUN     ]' doesn't have corresponding '[  FAILED  ]' afterwards.
-    """
-    no_fail_info = '[ RUN      ]' in next(line for line in reversed(
-        out.splitlines()) if '[  FAILED  ]' in line or '[ RUN      ]' in line)
-    return returncode != 0 and no_fail_info
+def get_footprints(cmd, tests):
+    '''Call --list-footprints on test binary and get space each test takes \
+    in test directory, in bytes or EXCLUSIVE.'''
+    footprints_out = check_output(cmd + ['--list-footprints']).decode('utf-8')
+    footprints = {}
+    for line in footprints_out.splitlines():
+        fields = line.split()
+        if len(fields) == 2:
+            footprints[fields[0]] = fields[1] if fields[1] == EXCLUSIVE\
+                else int(fields[1])
+
+    return OrderedDict((test, footprints.get(test, EXCLUSIVE))
+                       for test in tests)
+
+
+def get_free_space(testdirs):
+    '''Return the smallest free space of file systems of test directories.'''
+    # test directories themselves are removed by the binary, check parents
+    return min(disk_usage(path.dirname(testdir)).free for testdir in testdirs)
+
+
+class Scheduler:
+    '''Admit tests to run in parallel workers only while summed footprint \
+    of running tests fits in free space of test directories. Free space is \
+    measured before each admission, as a capacity while no test runs and to \
+    catch space taken by others while tests run. Test which does not fit \
+    even alone, or takes whole test directory, runs alone. Space of the \
+    first pending test which does not fit is reserved, so that smaller \
+    tests behind it cannot starve it.'''
+
+    def __init__(self, footprints, measure_free_space, jobs):
+        self.pending = footprints
+        self.measure_free_space = measure_free_space
+        self.capacity = 0
+        self.jobs = jobs
+        self.running = {}
+
+    def used_space(self):
+        return sum(self.running.values())
+
+    def fits(self, footprint, free_space, reserved):
+        if not self.running:
+            return True
+        if footprint == EXCLUSIVE or EXCLUSIVE in self.running.values():
+            return False
+        return footprint <= free_space and\
+            self.used_space() + reserved + footprint <= self.capacity
+
+    def admit(self):
+        '''Return next test which can be started now, or None.'''
+        if len(self.running) >= self.jobs or\
+                EXCLUSIVE in self.running.values():
+            return None
+        free_space = self.measure_free_space()
+        if not self.running:
+            self.capacity = free_space
+        reserved = 0
+        for test, footprint in self.pending.items():
+            if self.fits(footprint, free_space, reserved):
+                del self.pending[test]
+                self.running[test] = footprint
+                return test
+            if footprint == EXCLUSIVE:
+                # keep the order, so exclusive test is not starved
+                return None
+            if not reserved:
+                reserved = footprint
+        return None
+
+    def finish(self, test):
+        del self.running[test]
+
+
+def execute_parallel(binary, testdirs, excluded, timeout, binary_args, jobs,
+                     history, cache):
+    '''Run each test in a separate process in up to jobs parallel workers, \
+    each using its own subdirectory of test directory. Tests are started \
+    longest first according to history, so that duration of the run is \
+    bounded by the longest test rather than by unlucky order.'''
+    cmd = [binary, '--gtest_filter=-{}'.format(excluded)]\
+        if excluded else [binary]
+    cmd.extend(binary_args)
+    all_tests = get_all_tests_to_run(cmd)
+    footprints = get_footprints(cmd, history.longest_first(all_tests))
+    scheduler = Scheduler(footprints, lambda: get_free_space(testdirs), jobs)
+
+    deadline = time() + timeout if timeout else None
+    free_workers = list(range(jobs))
+    workers = {}
+    failed = []
+    terminated = []
+
+    while scheduler.pending or workers:
+        test = scheduler.admit()
+        while test:
+            worker = free_workers.pop(0)
+            process = Popen([binary, '--gtest_filter={}'.format(test),
+                             '--worker={}'.format(worker)] + binary_args)
+            workers[worker] = (process, test, time())
+            test = scheduler.admit()
+
+        for worker, (process, test, start) in list(workers.items()):
+            returncode = process.poll()
+            if returncode is None:
+                continue
+
+            del workers[worker]
+            free_workers.append(worker)
+            scheduler.finish(test)
+            duration_ms = int((time() - start) * 1000)
+            history.record(test, duration_ms)
+
+            result = 'passed'
+            if returncode < 0 or returncode == WATCHDOG_EXIT_CODE:
+                result = 'crashed' if returncode < 0 else 'timed out'
+                terminated.append(test)
+                remove_testdirs([path.join(testdir, 'worker_{}'.format(
+                    worker)) for testdir in testdirs])
+            elif returncode != 0:
+                result = 'failed'
+                failed.append(test)
+
+            if cache:
+                cache.record(test, result)
+            print('[{}/{}] {} {} ({} ms)'.format(
+                len(all_tests) - len(scheduler.pending) - len(workers),
+                len(all_tests), test, result, duration_ms))
+
+        if deadline and time() > deadline:
+            for process, _, _ in workers.values():
+                process.kill()
+                process.wait()
+            remove_testdirs(testdirs)
+            sys.exit('Execution timed out.')
+
+        sleep(WORKERS_POLL_INTERVAL)
+
+    if failed or terminated:
+        print_summary(failed, terminated, all_tests, binary)
+        return 1
+
+    return 0
 
 
 def print_summary(failed, terminated, all_tests, binary):
@@ -128,49 +468,66 @@ def print_summary(failed, terminated, all_tests, binary):
         for test in failed:
             print(test)
 
+    if terminated:
         print('{}{} test(s) led to binary termination:'
               .format(linesep, len(terminated)))
         for test in terminated:
             print(test)
 
 
-def execute_all_tests(binary, testdir, excluded, timeout):
+def execute_all_tests(binary, testdirs, excluded, timeout, binary_args,
+                      history, cache):
     '''Run all tests from binary, check last ran test after finished process.
     Resume execution omitting already ran tests until all tests are run \
     or timeout occurs.
     '''
     cmd = [binary, '--gtest_filter=-{}'.format(excluded)]\
         if excluded else [binary]
+    cmd.extend(binary_args)
     all_tests = get_all_tests_to_run(cmd)
 
-    failing_tests = []
     terminating_tests = []
 
-    out, returncode = execute(cmd, timeout, testdir)
-    failing_tests.extend(get_fails(out))
-    last_ran_test = get_last_ran_test(out)
-    if not last_ran_test:
-        sys.exit("Could not get last ran test from execution output.")
-
-    while last_ran_test != all_tests[-1]:
-        print()
-        print('Test {} triggered execution termination. Resuming execution.'
-              .format(last_ran_test))
-        terminating_tests.append(last_ran_test)
-        rmtree(testdir, ignore_errors=True)
-
-        cmd = [binary, gtest_filter_rest(last_ran_test, all_tests, excluded)]
-        out, returncode = execute(cmd, timeout, testdir)
-        last_ran_test = get_last_ran_test(out)
-        failing_tests.extend(get_fails(out))
-
-    if last_test_terminated(out, returncode):
-        terminating_tests.append(last_ran_test)
-
-    if terminating_tests:
-        print_summary(failing_tests, terminating_tests, all_tests, binary)
+    with TemporaryDirectory() as events_dir:
+        events = TestEvents(path.join(events_dir, 'events.jsonl'),
+                            len(all_tests), history, cache)
+        returncode = execute(cmd, timeout, testdirs, events)
+        if not events.last_started:
+            sys.exit("Could not get last ran test from execution events.")
+
+        while events.running or (returncode != 0 and
+                                 events.last_started != all_tests[-1]):
+            last_ran_test = events.last_started
+            print()
+            if returncode == WATCHDOG_EXIT_CODE:
+                msg = 'Test {} exceeded its time budget.'
+            else:
+                msg = 'Test {} triggered execution termination.'
+            terminating_tests.append(last_ran_test)
+            events.running = None
+            events.finished += 1
+            remove_testdirs(testdirs)
+
+            # no tests left to resume after the last one
+            if last_ran_test == all_tests[-1]:
+                print(msg.format(last_ran_test))
+                break
+            print(msg.format(last_ran_test) + ' Resuming execution.')
+
+            cmd = [binary, '--start-after={}'.format(last_ran_test)]
+            if excluded:
+                cmd.append('--gtest_filter=-{}'.format(excluded))
+            cmd.extend(binary_args)
+            returncode = execute(cmd, timeout, testdirs, events)
+            if events.last_started == last_ran_test and not events.running:
+                sys.exit('Could not resume execution after {}.'
+                         .format(last_ran_test))
+
+    failing_tests = events.failed
+    terminating_tests.extend(events.crashed)
 
     if terminating_tests or failing_tests:
+        print_summary(failing_tests, terminating_tests, all_tests, binary)
         return 1
 
     return 0
@@ -184,9 +541,37 @@ if __name__ == '__main__':
     parser.add_argument(
         '--timeout', help='Timeout in minutes, default: 60 minutes.'
                           ' Set to 0 for no timeout.', type=int, default=60)
+    parser.add_argument(
+        '--test-timeout', help='Time budget of a single test in seconds.'
+                               ' Test exceeding it terminates the binary.',
+        type=int, default=0)
+    parser.add_argument(
+        '--command-timeout', help='Timeout of a single command executed by'
+                                  ' tests in seconds.', type=int, default=0)
     parser.add_argument(
         '-e', '--exclude', help='Tests to be excluded from'
                                 ' execution (using gtest_filter semantics)')
+    parser.add_argument(
+        '-j', '--jobs', help='Number of tests run in parallel, each in its'
+                             ' own process and test directory. Tests are'
+                             ' started only while their footprints fit in'
+                             ' free space of test directory, default: 1.',
+        type=int, default=1)
+    parser.add_argument(
+        '--cache', help='Directory of result cache. Tests which passed'
+                        ' before with the same test binary, pmempool and'
+                        ' libpmem* libraries, parameters and file system of'
+                        ' test directory are not run again.')
+    parser.add_argument(
+        '--force-rerun', action='store_true',
+        help='Run all tests even if their results are cached, updating'
+             ' the cache.')
+    parser.add_argument(
+        '--history', help='File with durations of tests from previous runs,'
+                          ' used to start the longest tests first in'
+                          ' parallel execution and updated after each run,'
+                          ' default: <binary>_durations.json next to the'
+                          ' binary.')
 
     args = parser.parse_args()
 
@@ -195,9 +580,51 @@ if __name__ == '__main__':
     # check binary path first for more informative error message
     Path(args.gtest_binary).resolve()
 
-    testdir = get_testdir_from_xml(args.gtest_binary)
-
-    exit_code = execute_all_tests(
-        args.gtest_binary, testdir, args.exclude, timeout)
+    testdirs = get_testdirs_from_xml(args.gtest_binary)
+
+    binary_args = []
+    if args.test_timeout:
+        binary_args.append('--test-timeout={}'.format(args.test_timeout))
+    if args.command_timeout:
+        binary_args.append(
+            '--command-timeout={}'.format(args.command_timeout))
+
+    history = DurationHistory(
+        args.history or args.gtest_binary + '_durations.json')
+
+    cache = None
+    excluded = args.exclude
+    with TemporaryDirectory() as tmpdir:
+        if args.cache:
+            cmd = [args.gtest_binary, '--gtest_filter=-{}'.format(excluded)]\
+                if excluded else [args.gtest_binary]
+            cache = ResultCache(args.cache, args.gtest_binary, binary_args,
+                                path.dirname(testdirs[0]),
+                                list_tests(cmd + binary_args))
+            passed = [] if args.force_rerun else cache.passed_tests()
+            for test in passed:
+                print('{} passed (cached)'.format(test))
+            if passed and len(passed) == len(cache.params):
+                sys.exit(0)
+            if passed:
+                # a file rather than gtest filter, which would grow with cache
+                skip_file = path.join(tmpdir, 'skip_tests.txt')
+                with open(skip_file, 'w') as f:
+                    f.write('\n'.join(passed) + '\n')
+                binary_args.append('--skip-tests-file={}'.format(skip_file))
+
+        try:
+            if args.jobs > 1:
+                exit_code = execute_parallel(args.gtest_binary, testdirs,
+                                             excluded, timeout, binary_args,
+                                             args.jobs, history, cache)
+            else:
+                exit_code = execute_all_tests(args.gtest_binary, testdirs,
+                                              excluded, timeout, binary_args,
+                                              history, cache)
+        finally:
+            history.save()
+            if cache:
+                cache.save()
 
     sys.exit(exit_code)
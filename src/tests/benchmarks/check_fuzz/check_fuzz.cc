@@ -0,0 +1,448 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef __linux__
+
+#include "check_fuzz.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <libpmemblk.h>
+#include <libpmemlog.h>
+#include <libpmemobj.h>
+#include <libpmempool.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <random>
+#include <sstream>
+#include "api_c/api_c.h"
+#include "test_utils/file_utils.h"
+
+namespace {
+const std::array<std::string, struct_utils::ConvertEnum<int>(
+                                  MutationKind::Count)>
+    MUTATION_NAMES{{"bit flip", "random bytes", "zero", "fill"}};
+
+const std::array<std::string, struct_utils::ConvertEnum<int>(Verdict::Count)>
+    VERDICT_NAMES{{"consistent", "not_consistent", "check_error",
+                   "setup_error", "crash", "hang", "wrong_verdict"}};
+
+/* offsets below follow on-media layout of PMDK pools */
+const size_t POOL_HDR_SIZE = 4 * KIBIBYTE;
+const size_t OBJ_LANES_OFFSET = 8 * KIBIBYTE;
+const size_t OBJ_LANES_SIZE = 1024 * 3 * KIBIBYTE;
+const size_t BLK_ARENA_OFFSET = 8 * KIBIBYTE;
+const size_t LOG_DATA_OFFSET = 8 * KIBIBYTE;
+}
+
+std::string CheckFuzz::GetName(Verdict verdict) {
+  return VERDICT_NAMES[struct_utils::ConvertEnum<int>(verdict)];
+}
+
+unsigned CheckFuzz::GetWorkersCount() {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void CheckFuzz::SetUp() {
+  PoolType pool_type = std::get<0>(GetParam());
+
+  /* checksummed fields of pool header, common to all pool types */
+  regions_ = {{"pool_hdr", 0, KIBIBYTE, true}};
+
+  switch (pool_type) {
+    case PoolType::Obj:
+      regions_.push_back({"obj_descriptor", POOL_HDR_SIZE, POOL_HDR_SIZE,
+                          false});
+      regions_.push_back({"lanes", OBJ_LANES_OFFSET, OBJ_LANES_SIZE, false});
+      regions_.push_back({"heap", OBJ_LANES_OFFSET + OBJ_LANES_SIZE,
+                          MEBIBYTE, false});
+      break;
+    case PoolType::Blk:
+      regions_.push_back({"blk_descriptor", POOL_HDR_SIZE, POOL_HDR_SIZE,
+                          false});
+      regions_.push_back({"btt_info", BLK_ARENA_OFFSET, 4 * KIBIBYTE,
+                          false});
+      regions_.push_back({"btt_map_flog",
+                          FUZZ_POOL_SIZE - 4 * KIBIBYTE - 256 * KIBIBYTE,
+                          256 * KIBIBYTE, false});
+      regions_.push_back({"btt_info_backup", FUZZ_POOL_SIZE - 4 * KIBIBYTE,
+                          4 * KIBIBYTE, false});
+      break;
+    case PoolType::Log:
+      regions_.push_back({"log_descriptor", POOL_HDR_SIZE, POOL_HDR_SIZE,
+                          false});
+      regions_.push_back({"log_data", LOG_DATA_OFFSET, 64 * KIBIBYTE,
+                          false});
+      break;
+    default:
+      FAIL() << "Unsupported pool type";
+  }
+
+  ASSERT_EQ(0, CreateTemplate());
+  long long check_time_us = 0;
+  ASSERT_EQ(0, file_utils::CheckConsistency(template_path_, check_time_us));
+}
+
+int CheckFuzz::CreateTemplate() const {
+  const char *path = template_path_.c_str();
+  const std::string data(4 * KIBIBYTE, 'P');
+
+  switch (std::get<0>(GetParam())) {
+    case PoolType::Obj: {
+      PMEMobjpool *pop = pmemobj_create(path, nullptr, FUZZ_POOL_SIZE, 0644);
+      if (pop == nullptr) {
+        std::cerr << pmemobj_errormsg() << std::endl;
+        return -1;
+      }
+
+      /* populate heap metadata with allocations of several sizes */
+      for (size_t size = 64; size <= 256 * KIBIBYTE; size *= 4) {
+        PMEMoid oid;
+        pmemobj_alloc(pop, &oid, size, 1, nullptr, nullptr);
+      }
+      pmemobj_close(pop);
+      return 0;
+    }
+    case PoolType::Blk: {
+      PMEMblkpool *pbp = pmemblk_create(path, 512, FUZZ_POOL_SIZE, 0644);
+      if (pbp == nullptr) {
+        std::cerr << pmemblk_errormsg() << std::endl;
+        return -1;
+      }
+
+      /* populate BTT map and flog */
+      for (long long block = 0; block < 64; ++block) {
+        pmemblk_write(pbp, data.c_str(), block * 7);
+      }
+      pmemblk_close(pbp);
+      return 0;
+    }
+    case PoolType::Log: {
+      PMEMlogpool *plp = pmemlog_create(path, FUZZ_POOL_SIZE, 0644);
+      if (plp == nullptr) {
+        std::cerr << pmemlog_errormsg() << std::endl;
+        return -1;
+      }
+
+      pmemlog_append(plp, data.c_str(), data.size());
+      pmemlog_close(plp);
+      return 0;
+    }
+    default:
+      return -1;
+  }
+}
+
+std::string CheckFuzz::GetCasePath(unsigned index) const {
+  return local_config->GetTestDir() + "case_" + std::to_string(index) +
+         ".pool";
+}
+
+std::vector<Mutation> CheckFuzz::GenerateMutations(uint64_t seed) const {
+  std::mt19937_64 generator{seed};
+  std::vector<Mutation> mutations(
+      std::uniform_int_distribution<unsigned>(1, max_mutations_)(generator));
+
+  for (auto &mutation : mutations) {
+    mutation.region = std::uniform_int_distribution<unsigned>(
+        0, regions_.size() - 1)(generator);
+    mutation.kind = static_cast<MutationKind>(
+        std::uniform_int_distribution<int>(
+            0, struct_utils::ConvertEnum<int>(MutationKind::Count) -
+                   1)(generator));
+
+    const MetadataRegion &region = regions_[mutation.region];
+    size_t max_length = mutation.kind == MutationKind::BitFlip
+                            ? 1
+                            : mutation.kind == MutationKind::RandomBytes
+                                  ? 64
+                                  : 512;
+    mutation.length = std::uniform_int_distribution<size_t>(
+        1, std::min(max_length, region.length))(generator);
+    mutation.offset =
+        region.offset + std::uniform_int_distribution<size_t>(
+                            0, region.length - mutation.length)(generator);
+    mutation.value_seed = generator();
+  }
+
+  return mutations;
+}
+
+int CheckFuzz::ApplyMutations(const std::string &path,
+                              const std::vector<Mutation> &mutations,
+                              bool &detect_required) const {
+  int fd = open(path.c_str(), O_RDWR);
+
+  if (fd == -1) {
+    std::cerr << "Unable to open file: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  void *addr =
+      mmap(nullptr, FUZZ_POOL_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (addr == MAP_FAILED) {
+    std::cerr << "Unable to map file: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  char *pool = static_cast<char *>(addr);
+  detect_required = false;
+
+  for (const auto &mutation : mutations) {
+    char *range = pool + mutation.offset;
+    std::vector<char> before(range, range + mutation.length);
+    std::mt19937_64 generator{mutation.value_seed};
+
+    switch (mutation.kind) {
+      case MutationKind::BitFlip:
+        range[0] ^= static_cast<char>(1 << (mutation.value_seed % 8));
+        break;
+      case MutationKind::RandomBytes:
+        for (size_t i = 0; i < mutation.length; ++i) {
+          range[i] = static_cast<char>(generator());
+        }
+        break;
+      case MutationKind::Zero:
+        memset(range, 0, mutation.length);
+        break;
+      default:
+        memset(range, 0xFF, mutation.length);
+    }
+
+    if (regions_[mutation.region].must_detect &&
+        memcmp(before.data(), range, mutation.length) != 0) {
+      detect_required = true;
+    }
+  }
+
+  int ret = msync(addr, FUZZ_POOL_SIZE, MS_SYNC);
+  munmap(addr, FUZZ_POOL_SIZE);
+
+  return ret;
+}
+
+Verdict CheckFuzz::CheckPool(const std::string &path) const {
+  if (std::get<1>(GetParam()) == Interface::CLI) {
+    pid_t pid = fork();
+
+    if (pid == 0) {
+      int null_fd = open("/dev/null", O_WRONLY);
+      dup2(null_fd, STDOUT_FILENO);
+      dup2(null_fd, STDERR_FILENO);
+      execlp("pmempool", "pmempool", "check", path.c_str(), nullptr);
+      _exit(127);
+    }
+
+    int status = 0;
+    if (pid == -1 || waitpid(pid, &status, 0) != pid) {
+      return Verdict::SetupError;
+    }
+    if (WIFSIGNALED(status)) {
+      return Verdict::Crash;
+    }
+    if (WEXITSTATUS(status) == 127) {
+      return Verdict::SetupError;
+    }
+
+    return WEXITSTATUS(status) == 0 ? Verdict::Consistent
+                                    : Verdict::NotConsistent;
+  }
+
+  struct pmempool_check_args args;
+  args.path = path.c_str();
+  args.backup_path = nullptr;
+  args.pool_type = PMEMPOOL_POOL_TYPE_DETECT;
+  args.flags = PMEMPOOL_CHECK_FORMAT_STR;
+
+  PMEMpoolcheck *ppc = pmempool_check_init(&args, sizeof(args));
+
+  /* pool which cannot be recognized is reported as inconsistent */
+  if (ppc == nullptr) {
+    return Verdict::NotConsistent;
+  }
+
+  while (pmempool_check(ppc) != nullptr) {
+  }
+
+  switch (pmempool_check_end(ppc)) {
+    case PMEMPOOL_CHECK_RESULT_CONSISTENT:
+      return Verdict::Consistent;
+    case PMEMPOOL_CHECK_RESULT_ERROR:
+      return Verdict::CheckError;
+    default:
+      return Verdict::NotConsistent;
+  }
+}
+
+bool CheckFuzz::OpenPool(const std::string &path) const {
+  switch (std::get<0>(GetParam())) {
+    case PoolType::Obj: {
+      PMEMobjpool *pop = pmemobj_open(path.c_str(), nullptr);
+      if (pop != nullptr) {
+        pmemobj_close(pop);
+      }
+      return pop != nullptr;
+    }
+    case PoolType::Blk: {
+      PMEMblkpool *pbp = pmemblk_open(path.c_str(), 0);
+      if (pbp != nullptr) {
+        pmemblk_close(pbp);
+      }
+      return pbp != nullptr;
+    }
+    case PoolType::Log: {
+      PMEMlogpool *plp = pmemlog_open(path.c_str());
+      if (plp != nullptr) {
+        pmemlog_close(plp);
+      }
+      return plp != nullptr;
+    }
+    default:
+      return false;
+  }
+}
+
+Verdict CheckFuzz::RunCase(unsigned index) const {
+  const std::string path = GetCasePath(index);
+  bool detect_required = false;
+
+  if (ApiC::CloneFile(template_path_, path) != 0 ||
+      ApplyMutations(path, GenerateMutations(base_seed_ + index),
+                     detect_required) != 0) {
+    return Verdict::SetupError;
+  }
+
+  Verdict verdict = CheckPool(path);
+
+  /* pool reported as consistent has to be usable by its library */
+  if (verdict == Verdict::Consistent && (detect_required || !OpenPool(path))) {
+    return Verdict::WrongVerdict;
+  }
+
+  return verdict;
+}
+
+std::string CheckFuzz::Describe(unsigned index) const {
+  std::ostringstream description;
+  description << "case " << index << " (seed " << base_seed_ + index << "):";
+
+  for (const auto &mutation : GenerateMutations(base_seed_ + index)) {
+    description << " " << MUTATION_NAMES[struct_utils::ConvertEnum<int>(
+                              mutation.kind)]
+                << " of " << mutation.length << " bytes at "
+                << regions_[mutation.region].name << "+"
+                << mutation.offset - regions_[mutation.region].offset << ";";
+  }
+
+  return description.str();
+}
+
+int CheckFuzz::Run(std::vector<Verdict> &verdicts) const {
+  struct Worker {
+    unsigned index;
+    std::chrono::steady_clock::time_point start;
+    bool killed;
+  };
+  std::map<pid_t, Worker> workers;
+  unsigned next = 0;
+
+  verdicts.assign(cases_count_, Verdict::SetupError);
+
+  while (next < cases_count_ || !workers.empty()) {
+    while (workers.size() < workers_count_ && next < cases_count_) {
+      pid_t pid = fork();
+
+      if (pid == -1) {
+        std::cerr << "Unable to fork: " << strerror(errno) << std::endl;
+        return -1;
+      }
+
+      if (pid == 0) {
+        /* own process group lets parent kill checker started by worker */
+        setpgid(0, 0);
+        _exit(struct_utils::ConvertEnum<int>(RunCase(next)));
+      }
+
+      setpgid(pid, pid);
+      workers[pid] = {next++, std::chrono::steady_clock::now(), false};
+    }
+
+    int status = 0;
+    pid_t pid = waitpid(-1, &status, WNOHANG);
+
+    if (pid > 0) {
+      const Worker &worker = workers[pid];
+      Verdict &verdict = verdicts[worker.index];
+
+      if (worker.killed) {
+        verdict = Verdict::Hang;
+      } else if (WIFSIGNALED(status)) {
+        verdict = Verdict::Crash;
+      } else if (WEXITSTATUS(status) <
+                 struct_utils::ConvertEnum<int>(Verdict::Count)) {
+        verdict = static_cast<Verdict>(WEXITSTATUS(status));
+      }
+
+      ApiC::RemoveFile(GetCasePath(worker.index));
+      workers.erase(pid);
+      continue;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    for (auto &worker : workers) {
+      if (!worker.second.killed &&
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              now - worker.second.start)
+                  .count() > timeout_us_) {
+        kill(-worker.first, SIGKILL);
+        worker.second.killed = true;
+      }
+    }
+
+    usleep(500);
+  }
+
+  return 0;
+}
+
+void CheckFuzz::TearDown() {
+  ApiC::CleanDirectory(local_config->GetTestDir());
+}
+
+#endif  // __linux__
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_BENCHMARKS_CHECK_FUZZ_CHECK_FUZZ_H_
+#define PMDK_TESTS_SRC_TESTS_BENCHMARKS_CHECK_FUZZ_CHECK_FUZZ_H_
+
+#include <stdint.h>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include "configXML/local_configuration.h"
+#include "constants.h"
+#include "gtest/gtest.h"
+#include "report.h"
+#include "structures.h"
+
+extern std::unique_ptr<LocalConfiguration> local_config;
+
+/* size of template pool and of each of its clones */
+static const size_t FUZZ_POOL_SIZE = 32 * MEBIBYTE;
+
+/*
+ * MetadataRegion -- range of pool file holding metadata of given kind. Any
+ * change of region with must_detect set has to be reported by pmempool check.
+ */
+struct MetadataRegion {
+  std::string name;
+  size_t offset;
+  size_t length;
+  bool must_detect;
+};
+
+enum class MutationKind { BitFlip, RandomBytes, Zero, Fill, Count };
+
+struct Mutation {
+  unsigned region;
+  size_t offset;
+  size_t length;
+  MutationKind kind;
+  uint64_t value_seed;
+};
+
+/* outcome of checking single corrupted pool, used as exit code of worker */
+enum class Verdict {
+  Consistent,
+  NotConsistent,
+  CheckError,
+  SetupError,
+  Crash,
+  Hang,
+  WrongVerdict,
+  Count
+};
+
+/*
+ * CheckFuzz -- clones valid template pool, applies deterministic mutations to
+ * its metadata and runs pmempool check on the clone. Each pool is checked in
+ * separate worker process, so crashes and hangs of the checker are caught.
+ */
+class CheckFuzz
+    : public ::testing::TestWithParam<std::tuple<PoolType, Interface>> {
+ private:
+  std::vector<Mutation> GenerateMutations(uint64_t seed) const;
+  int ApplyMutations(const std::string &path,
+                     const std::vector<Mutation> &mutations,
+                     bool &detect_required) const;
+  Verdict CheckPool(const std::string &path) const;
+  bool OpenPool(const std::string &path) const;
+  Verdict RunCase(unsigned index) const;
+
+ public:
+  const std::string template_path_ =
+      local_config->GetTestDir() + "template.pool";
+  const unsigned cases_count_ = 2000;
+  const unsigned max_mutations_ = 3;
+  const uint64_t base_seed_ = 0x5EED;
+  const unsigned workers_count_ = GetWorkersCount();
+  const long long timeout_us_ = 30 * 1000000LL;
+  std::vector<MetadataRegion> regions_;
+
+  static std::string GetName(Verdict verdict);
+  static unsigned GetWorkersCount();
+  std::string GetCasePath(unsigned index) const;
+  std::string Describe(unsigned index) const;
+  int CreateTemplate() const;
+  int Run(std::vector<Verdict> &verdicts) const;
+
+  void SetUp() override;
+  void TearDown() override;
+};
+
+#endif  // !PMDK_TESTS_SRC_TESTS_BENCHMARKS_CHECK_FUZZ_CHECK_FUZZ_H_
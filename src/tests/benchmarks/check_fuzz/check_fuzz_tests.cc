@@ -0,0 +1,106 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef __linux__
+
+#include "check_fuzz.h"
+#include "test_runner/footprint.h"
+#include "timer/timer.h"
+
+namespace {
+/* template pool and full copy of it for each worker if reflink fails */
+const Footprint check_fuzz_footprint{
+    "Benchmarks/CheckFuzz", [](size_t) {
+      return FUZZ_POOL_SIZE * (1 + CheckFuzz::GetWorkersCount());
+    }};
+}  // namespace
+
+/**
+ * CheckFuzz.PMEMPOOL_CHECK_CORRUPTED_POOLS
+ * Checking consistency of many corrupted copies of valid pool with pmempool
+ * check, using command line tool or libpmempool API
+ * \test
+ *          \li \c Step1. For each case clone template pool, mutate its
+ *          metadata with seed derived from case number and check the clone
+ *          in worker process, keeping several workers running in parallel
+ *          / SUCCESS
+ *          \li \c Step2. Record number of checked pools per minute and
+ *          number of cases with each verdict / SUCCESS
+ *          \li \c Step3. Make sure that checker did not crash, hang or
+ *          report corrupted pool as consistent
+ */
+TEST_P(CheckFuzz, PMEMPOOL_CHECK_CORRUPTED_POOLS) {
+  std::vector<Verdict> verdicts;
+  Timer timer;
+
+  /* Step 1 */
+  timer.Start();
+  ASSERT_EQ(0, Run(verdicts));
+  timer.Stop();
+
+  /* Step 2 */
+  std::array<unsigned, struct_utils::ConvertEnum<int>(Verdict::Count)>
+      counts{};
+  for (unsigned i = 0; i < verdicts.size(); ++i) {
+    ++counts[struct_utils::ConvertEnum<int>(verdicts[i])];
+
+    if (verdicts[i] == Verdict::Crash || verdicts[i] == Verdict::Hang ||
+        verdicts[i] == Verdict::WrongVerdict) {
+      std::cout << GetName(verdicts[i]) << ": " << Describe(i) << std::endl;
+    }
+  }
+
+  report::Record("cases", cases_count_);
+  report::Record("workers", workers_count_);
+  report::Record("pools_per_minute",
+                 timer.GetElapsed() > 0
+                     ? cases_count_ * 60000000.0 / timer.GetElapsed()
+                     : 0);
+  for (int i = 0; i < struct_utils::ConvertEnum<int>(Verdict::Count); ++i) {
+    report::Record(GetName(static_cast<Verdict>(i)), counts[i]);
+  }
+
+  /* Step 3 */
+  EXPECT_EQ(0u, counts[struct_utils::ConvertEnum<int>(Verdict::SetupError)]);
+  EXPECT_EQ(0u, counts[struct_utils::ConvertEnum<int>(Verdict::Crash)]);
+  EXPECT_EQ(0u, counts[struct_utils::ConvertEnum<int>(Verdict::Hang)]);
+  EXPECT_EQ(0u,
+            counts[struct_utils::ConvertEnum<int>(Verdict::WrongVerdict)]);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Benchmarks, CheckFuzz,
+    ::testing::Combine(::testing::Values(PoolType::Obj, PoolType::Blk,
+                                         PoolType::Log),
+                       ::testing::Values(Interface::CLI, Interface::API)));
+
+#endif  // __linux__
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "create_scaling.h"
+#include "timer/timer.h"
+
+std::vector<size_t> PmempoolCreateScaling::GetSizes(size_t limit) const {
+  std::vector<size_t> sizes;
+
+  for (size_t size =
+           struct_utils::POOL_MIN_SIZES[struct_utils::ConvertEnum<int>(
+               GetParam())];
+       size < limit; size *= growth_factor_) {
+    sizes.emplace_back(size);
+  }
+
+  return sizes;
+}
+
+int PmempoolCreateScaling::CreatePool(const Arg &size_arg,
+                                      CreateSample &sample) {
+  PoolArgs pool_args{GetParam(), {size_arg}};
+
+  if (GetParam() == PoolType::Blk) {
+    pool_args.args.emplace_back(Option::BSize, OptionType::Short, "512");
+  }
+
+  std::string command =
+      "pmempool create " +
+      struct_utils::POOL_TYPES[struct_utils::ConvertEnum<int>(GetParam())] +
+      struct_utils::CombineArguments(pool_args.args) + pool_path_;
+
+  long long page_cache_before = ApiC::GetPageCacheSize();
+
+  Timer timer;
+  timer.Start();
+  int ret = shell_.ExecuteCommand(command).GetExitCode();
+  timer.Stop();
+
+  sample.create_time_us = timer.GetElapsed();
+  sample.page_cache_delta = ApiC::GetPageCacheSize() - page_cache_before;
+  sample.size = static_cast<size_t>(ApiC::GetFileSize(pool_path_));
+  sample.allocated_size = ApiC::GetAllocatedSize(pool_path_);
+
+  return ret;
+}
+
+void PmempoolCreateScaling::RecordSample(const std::string &prefix,
+                                         const CreateSample &sample) const {
+  report::Record(prefix + "size", sample.size);
+  report::Record(prefix + "create_time_us", sample.create_time_us);
+  report::Record(prefix + "allocated_size", sample.allocated_size);
+  report::Record(prefix + "page_cache_delta", sample.page_cache_delta);
+}
+
+void PmempoolCreateScaling::TearDown() {
+  ApiC::CleanDirectory(local_config->GetTestDir());
+}
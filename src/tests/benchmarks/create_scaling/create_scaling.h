@@ -0,0 +1,77 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_BENCHMARKS_CREATE_SCALING_CREATE_SCALING_H_
+#define PMDK_TESTS_SRC_TESTS_BENCHMARKS_CREATE_SCALING_CREATE_SCALING_H_
+
+#include <memory>
+#include <vector>
+#include "configXML/local_configuration.h"
+#include "gtest/gtest.h"
+#include "report.h"
+#include "shell/i_shell.h"
+#include "structures.h"
+
+extern std::unique_ptr<LocalConfiguration> local_config;
+
+struct CreateSample {
+  size_t size = 0;
+  long long create_time_us = 0;
+  long long allocated_size = 0;
+  long long page_cache_delta = 0;
+};
+
+/*
+ * PmempoolCreateScaling -- measures how time and resources needed by
+ * pmempool create grow with size of created pool, from minimal pool size up
+ * to all free space of test directory.
+ */
+class PmempoolCreateScaling : public ::testing::TestWithParam<PoolType> {
+ private:
+  IShell shell_;
+
+ public:
+  const std::string pool_path_ = local_config->GetTestDir() + "pool.file";
+  const size_t growth_factor_ = 4;
+
+  std::vector<size_t> GetSizes(size_t limit) const;
+  int CreatePool(const Arg &size_arg, CreateSample &sample);
+  void RecordSample(const std::string &prefix,
+                    const CreateSample &sample) const;
+  std::string GetOutputContent() const {
+    return shell_.GetLastOutput().GetContent();
+  }
+
+  void TearDown() override;
+};
+
+#endif  // !PMDK_TESTS_SRC_TESTS_BENCHMARKS_CREATE_SCALING_CREATE_SCALING_H_
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "create_scaling.h"
+#include "statistics.h"
+#include "test_runner/footprint.h"
+
+namespace {
+/* the largest pool takes whole free space of test directory */
+const Footprint create_scaling_footprint{"Benchmarks/PmempoolCreateScaling",
+                                         Footprint::EXCLUSIVE};
+}  // namespace
+
+/**
+ * PmempoolCreateScaling.CREATE_TIME_SCALING
+ * Measuring pmempool create time for growing pool sizes
+ * \test
+ *          \li \c Step1. Create pools of sizes growing geometrically from
+ *          minimal pool size up to free space of test directory and remove
+ *          each of them / SUCCESS
+ *          \li \c Step2. Create pool with --max-size option / SUCCESS
+ *          \li \c Step3. Record per-GiB and fixed cost of pool creation
+ *          fitted to all samples / SUCCESS
+ */
+TEST_P(PmempoolCreateScaling, CREATE_TIME_SCALING) {
+  std::vector<double> sizes_gib;
+  std::vector<double> times_ms;
+  CreateSample sample;
+
+  auto AddSample = [&](const std::string &prefix) {
+    RecordSample(prefix, sample);
+    sizes_gib.emplace_back(static_cast<double>(sample.size) / GIGIBYTE);
+    times_ms.emplace_back(static_cast<double>(sample.create_time_us) / 1000);
+  };
+
+  /* Step 1 */
+  long long free_space = ApiC::GetFreeSpaceT(local_config->GetTestDir());
+  ASSERT_GT(free_space, 0);
+
+  for (size_t size : GetSizes(static_cast<size_t>(free_space))) {
+    ASSERT_EQ(0, CreatePool({Option::Size, OptionType::Long,
+                             std::to_string(size)},
+                            sample))
+        << GetOutputContent();
+    AddSample("size_" + std::to_string(size / MEBIBYTE) + "MiB_");
+    ASSERT_EQ(0, ApiC::RemoveFile(pool_path_));
+  }
+
+  /* Step 2 */
+  ASSERT_EQ(0, CreatePool({Option::MaxSize, OptionType::Long}, sample))
+      << GetOutputContent();
+  AddSample("max_size_");
+
+  /* Step 3 */
+  statistics::LinearFit fit = statistics::FitLinear(sizes_gib, times_ms);
+  report::Record("create_cost_ms_per_GiB", fit.slope);
+  report::Record("create_fixed_cost_ms", fit.intercept);
+}
+
+INSTANTIATE_TEST_CASE_P(Benchmarks, PmempoolCreateScaling,
+                        ::testing::Values(PoolType::Obj, PoolType::Blk,
+                                          PoolType::Log));
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef __linux__
+
+#include "fragmentation.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+int PoolFragmentation::AllocateFragmented() {
+  int pool_fd = open(pool_path_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  int filler_fd = open(filler_path_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  int ret = 0;
+
+  if (pool_fd == -1 || filler_fd == -1) {
+    std::cerr << "Unable to create file: " << strerror(errno) << std::endl;
+    ret = -1;
+  }
+
+  const size_t chunk = GetParam() == 0 ? FRAGMENTED_POOL_SIZE : GetParam();
+
+  for (size_t offset = 0; ret == 0 && offset < FRAGMENTED_POOL_SIZE;
+       offset += chunk) {
+    ret = posix_fallocate(pool_fd, static_cast<off_t>(offset),
+                          static_cast<off_t>(chunk));
+    if (ret == 0 && GetParam() != 0) {
+      ret = posix_fallocate(filler_fd, static_cast<off_t>(offset),
+                            static_cast<off_t>(chunk));
+    }
+
+    if (ret != 0) {
+      std::cerr << "Unable to allocate disk space: " << strerror(ret)
+                << std::endl;
+      ret = -1;
+    }
+  }
+
+  if (pool_fd != -1) {
+    close(pool_fd);
+  }
+  if (filler_fd != -1) {
+    close(filler_fd);
+    ApiC::RemoveFile(filler_path_);
+  }
+
+  return ret;
+}
+
+void PoolFragmentation::TearDown() {
+  ApiC::CleanDirectory(local_config->GetTestDir());
+}
+
+#endif  // __linux__
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_BENCHMARKS_FRAGMENTATION_FRAGMENTATION_H_
+#define PMDK_TESTS_SRC_TESTS_BENCHMARKS_FRAGMENTATION_FRAGMENTATION_H_
+
+#include <memory>
+#include "configXML/local_configuration.h"
+#include "constants.h"
+#include "gtest/gtest.h"
+#include "report.h"
+
+extern std::unique_ptr<LocalConfiguration> local_config;
+
+/* size of fragmented pool file */
+static const size_t FRAGMENTED_POOL_SIZE = 512 * MEBIBYTE;
+
+/*
+ * PoolFragmentation -- preallocates pool file in chunks interleaved with
+ * chunks of a filler file, which is removed afterwards. This leaves both the
+ * pool file and free space of file system fragmented. Parameter is the chunk
+ * size, 0 means that pool file is allocated at once.
+ */
+class PoolFragmentation : public ::testing::TestWithParam<size_t> {
+ public:
+  const std::string pool_path_ = local_config->GetTestDir() + "pool.file";
+  const std::string filler_path_ = local_config->GetTestDir() + "filler.file";
+  const size_t page_size_ = 4 * KIBIBYTE;
+
+  int AllocateFragmented();
+  void TearDown() override;
+};
+
+#endif  // !PMDK_TESTS_SRC_TESTS_BENCHMARKS_FRAGMENTATION_FRAGMENTATION_H_
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef __linux__
+
+#include <libpmem.h>
+#include <libpmemobj.h>
+#include <vector>
+#include "cache_mode/cache_mode.h"
+#include "fragmentation.h"
+#include "test_runner/footprint.h"
+#include "timer/timer.h"
+
+namespace {
+std::vector<size_t> GetChunkSizes() {
+  return {0, 64 * MEBIBYTE, 4 * MEBIBYTE, 256 * KIBIBYTE};
+}
+
+/* filler file interleaved with pool file takes as much space as the pool */
+const Footprint fragmentation_footprint{
+    "Benchmarks/PoolFragmentation", [](size_t index) {
+      return GetChunkSizes().at(index) == 0 ? FRAGMENTED_POOL_SIZE
+                                            : 2 * FRAGMENTED_POOL_SIZE;
+    }};
+}  // namespace
+
+/**
+ * PoolFragmentation.OPEN_AND_FIRST_TOUCH_LATENCY
+ * Measuring obj pool open and first-touch latency depending on number of
+ * extents of pool file
+ * \test
+ *          \li \c Step1. Preallocate pool file with given fragmentation and
+ *          read its extent map / SUCCESS
+ *          \li \c Step2. Create obj pool in preallocated file / SUCCESS
+ *          \li \c Step3. For each selected cache state open obj pool and
+ *          record open time / SUCCESS
+ *          \li \c Step4. For each selected cache state map pool file, write
+ *          one byte to each page and record first-touch time / SUCCESS
+ */
+TEST_P(PoolFragmentation, OPEN_AND_FIRST_TOUCH_LATENCY) {
+  /* Step 1 */
+  ASSERT_EQ(0, AllocateFragmented());
+
+  std::vector<FileExtent> extents;
+  if (ApiC::GetFileExtents(pool_path_, extents) != 0) {
+    report::Skip("file system does not provide extent map");
+    return;
+  }
+
+  report::Record("chunk_size", GetParam());
+  report::Record("extent_count", extents.size());
+  report::Record("allocated_size", ApiC::GetAllocatedSize(pool_path_));
+
+  /* Step 2 */
+  PMEMobjpool *pop = pmemobj_create(pool_path_.c_str(), nullptr, 0, 0644);
+  ASSERT_NE(nullptr, pop) << pmemobj_errormsg();
+  pmemobj_close(pop);
+
+  /* Step 3 */
+  Timer timer;
+  for (CacheState state : CacheMode::GetStates()) {
+    ASSERT_EQ(0, CacheMode::Prepare(state, {pool_path_}));
+
+    timer.Start();
+    pop = pmemobj_open(pool_path_.c_str(), nullptr);
+    timer.Stop();
+    ASSERT_NE(nullptr, pop) << pmemobj_errormsg();
+    pmemobj_close(pop);
+
+    report::Record(CacheMode::GetName(state) + "_open_time_us",
+                   timer.GetElapsed());
+  }
+
+  /* Step 4 */
+  for (CacheState state : CacheMode::GetStates()) {
+    ASSERT_EQ(0, CacheMode::Prepare(state, {pool_path_}));
+
+    size_t mapped_len = 0;
+    int is_pmem = 0;
+    char *addr = static_cast<char *>(
+        pmem_map_file(pool_path_.c_str(), 0, 0, 0, &mapped_len, &is_pmem));
+    ASSERT_NE(nullptr, addr) << pmem_errormsg();
+
+    timer.Start();
+    for (size_t offset = 0; offset < mapped_len; offset += page_size_) {
+      addr[offset] = 1;
+    }
+    timer.Stop();
+    EXPECT_EQ(0, pmem_unmap(addr, mapped_len));
+
+    const std::string prefix = CacheMode::GetName(state) + "_";
+    report::Record(prefix + "first_touch_time_us", timer.GetElapsed());
+    report::Record(prefix + "first_touch_ns_per_page",
+                   timer.GetElapsed<std::chrono::nanoseconds>() /
+                       static_cast<long long>(mapped_len / page_size_));
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(Benchmarks, PoolFragmentation,
+                        ::testing::ValuesIn(GetChunkSizes()));
+
+#endif  // __linux__
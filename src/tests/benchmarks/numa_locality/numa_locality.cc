@@ -0,0 +1,118 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "numa_locality.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "timer/timer.h"
+
+void PrintTo(Locality locality, std::ostream *os) {
+  *os << (locality == Locality::Local ? "local" : "remote");
+}
+
+void NumaLocality::SetUp() {
+  for (const auto &test_dir : local_config->GetTestDirs()) {
+    if (test_dir.numa_node == NUMA_NODE_UNKNOWN) {
+      continue;
+    }
+
+    if (local_dir_ == nullptr) {
+      local_dir_ = &test_dir;
+    } else if (test_dir.numa_node != local_dir_->numa_node) {
+      remote_dir_ = &test_dir;
+      break;
+    }
+  }
+}
+
+bool NumaLocality::IsConfigured() const {
+  bool configured = local_dir_ != nullptr &&
+                    (GetParam() == Locality::Local || remote_dir_ != nullptr);
+
+  if (!configured) {
+    report::Skip(std::string("config.xml lacks test directories on ") +
+                 (GetParam() == Locality::Local ? "any NUMA node"
+                                                : "two different NUMA nodes"));
+  }
+
+  return configured;
+}
+
+long long NumaLocality::RunPinned(const std::function<void(unsigned)> &work) {
+  std::vector<std::thread> threads;
+  std::atomic<unsigned> ready{0};
+  std::atomic<bool> start{false};
+  std::atomic<unsigned> pin_errors{0};
+
+  for (unsigned i = 0; i < threads_count_; ++i) {
+    threads.emplace_back([&, i] {
+      if (ApiC::PinThreadToNumaNode(local_dir_->numa_node) != 0) {
+        ++pin_errors;
+      }
+      ++ready;
+      while (!start) {
+        std::this_thread::yield();
+      }
+      work(i);
+    });
+  }
+
+  while (ready != threads_count_) {
+    std::this_thread::yield();
+  }
+
+  Timer timer;
+  timer.Start();
+  start = true;
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  timer.Stop();
+
+  EXPECT_EQ(0u, pin_errors.load());
+
+  return timer.GetElapsed();
+}
+
+void NumaLocality::RecordLocality() {
+  report::Record("locality", ::testing::PrintToString(GetParam()));
+  report::Record("thread_node", local_dir_->numa_node);
+  report::Record("pool_node", GetPoolDir().numa_node);
+}
+
+void NumaLocality::TearDown() {
+  for (const auto &test_dir : local_config->GetTestDirs()) {
+    ApiC::CleanDirectory(test_dir.path);
+  }
+}
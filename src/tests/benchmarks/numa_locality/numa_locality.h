@@ -0,0 +1,83 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_BENCHMARKS_NUMA_LOCALITY_NUMA_LOCALITY_H_
+#define PMDK_TESTS_SRC_TESTS_BENCHMARKS_NUMA_LOCALITY_NUMA_LOCALITY_H_
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include "configXML/local_configuration.h"
+#include "constants.h"
+#include "gtest/gtest.h"
+#include "report.h"
+
+extern std::unique_ptr<LocalConfiguration> local_config;
+
+enum class Locality { Local, Remote };
+
+void PrintTo(Locality locality, std::ostream *os);
+
+/* size of mapped pool file and of each replica of pool set */
+static const size_t NUMA_POOL_SIZE = 256 * MEBIBYTE;
+
+/*
+ * NumaLocality -- places pools in test directories tagged with NUMA nodes
+ * in config.xml and runs worker threads pinned to NUMA node of the first
+ * of them. For Locality::Local pool is placed on the same node as workers,
+ * for Locality::Remote on a different one.
+ */
+class NumaLocality : public ::testing::TestWithParam<Locality> {
+ private:
+  const TestDir *local_dir_ = nullptr;
+  const TestDir *remote_dir_ = nullptr;
+
+ public:
+  const unsigned threads_count_ = 4;
+  const size_t block_size_ = 4 * KIBIBYTE;
+
+  bool IsConfigured() const;
+  const TestDir &GetLocalDir() const {
+    return *local_dir_;
+  }
+  const TestDir &GetPoolDir() const {
+    return GetParam() == Locality::Local ? *local_dir_ : *remote_dir_;
+  }
+
+  long long RunPinned(const std::function<void(unsigned)> &work);
+  void RecordLocality();
+
+  void SetUp() override;
+  void TearDown() override;
+};
+
+#endif  // !PMDK_TESTS_SRC_TESTS_BENCHMARKS_NUMA_LOCALITY_NUMA_LOCALITY_H_
@@ -0,0 +1,205 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <libpmem.h>
+#include <libpmemobj.h>
+#include <vector>
+#include "numa_locality.h"
+#include "poolset/poolset.h"
+#include "poolset/poolset_management.h"
+#include "test_runner/footprint.h"
+
+namespace {
+const std::string POOL_FILE = "numa_pool";
+const std::string LAYOUT = "numa_locality";
+
+const Footprint numa_locality_footprint{"Benchmarks/NumaLocality",
+                                        NUMA_POOL_SIZE};
+
+/* pool and its replica */
+const Footprint numa_replica_footprint{
+    "Benchmarks/NumaLocality.POOLSET_REPLICA_WRITE_THROUGHPUT",
+    2 * NUMA_POOL_SIZE};
+
+double ToMiBps(size_t bytes, long long time_us) {
+  return time_us > 0 ? (static_cast<double>(bytes) / MEBIBYTE) /
+                           (static_cast<double>(time_us) / 1000000)
+                     : 0;
+}
+}  // namespace
+
+/**
+ * NumaLocality.MAPPED_POOL_WRITE_BANDWIDTH
+ * Measuring write bandwidth of mapped file placed on local and remote NUMA
+ * node
+ * \test
+ *          \li \c Step1. Map file in test directory on selected node / SUCCESS
+ *          \li \c Step2. Write whole file in blocks from threads pinned to
+ *          local node / SUCCESS
+ *          \li \c Step3. Record bandwidth / SUCCESS
+ */
+TEST_P(NumaLocality, MAPPED_POOL_WRITE_BANDWIDTH) {
+  if (!IsConfigured()) {
+    return;
+  }
+
+  /* Step 1 */
+  size_t mapped_len = 0;
+  int is_pmem = 0;
+  char *addr = static_cast<char *>(pmem_map_file(
+      (GetPoolDir().path + POOL_FILE).c_str(), NUMA_POOL_SIZE,
+      PMEM_FILE_CREATE, 0644, &mapped_len, &is_pmem));
+  ASSERT_NE(nullptr, addr) << pmem_errormsg();
+
+  /* Step 2 */
+  const size_t slice = mapped_len / threads_count_;
+  long long time_us = RunPinned([&](unsigned thread) {
+    std::vector<char> block(block_size_, static_cast<char>(thread + 1));
+    char *begin = addr + thread * slice;
+    for (size_t off = 0; off + block_size_ <= slice; off += block_size_) {
+      if (is_pmem) {
+        pmem_memcpy_persist(begin + off, block.data(), block_size_);
+      } else {
+        memcpy(begin + off, block.data(), block_size_);
+        pmem_msync(begin + off, block_size_);
+      }
+    }
+  });
+  EXPECT_EQ(0, pmem_unmap(addr, mapped_len));
+
+  /* Step 3 */
+  RecordLocality();
+  report::Record("is_pmem", is_pmem);
+  report::Record("write_bandwidth_MiBps", ToMiBps(mapped_len, time_us));
+}
+
+/**
+ * NumaLocality.MAPPED_POOL_READ_BANDWIDTH
+ * Measuring read bandwidth of mapped file placed on local and remote NUMA
+ * node
+ * \test
+ *          \li \c Step1. Map file in test directory on selected node and fill
+ *          it / SUCCESS
+ *          \li \c Step2. Read whole file in blocks from threads pinned to
+ *          local node / SUCCESS
+ *          \li \c Step3. Record bandwidth / SUCCESS
+ */
+TEST_P(NumaLocality, MAPPED_POOL_READ_BANDWIDTH) {
+  if (!IsConfigured()) {
+    return;
+  }
+
+  /* Step 1 */
+  size_t mapped_len = 0;
+  int is_pmem = 0;
+  char *addr = static_cast<char *>(pmem_map_file(
+      (GetPoolDir().path + POOL_FILE).c_str(), NUMA_POOL_SIZE,
+      PMEM_FILE_CREATE, 0644, &mapped_len, &is_pmem));
+  ASSERT_NE(nullptr, addr) << pmem_errormsg();
+  pmem_memset_persist(addr, 0xA5, mapped_len);
+
+  /* Step 2 */
+  const size_t slice = mapped_len / threads_count_;
+  std::vector<unsigned long long> sums(threads_count_, 0);
+  long long time_us = RunPinned([&](unsigned thread) {
+    std::vector<char> block(block_size_);
+    const char *begin = addr + thread * slice;
+    for (size_t off = 0; off + block_size_ <= slice; off += block_size_) {
+      memcpy(block.data(), begin + off, block_size_);
+      sums[thread] += static_cast<unsigned char>(block[0]);
+    }
+  });
+  EXPECT_EQ(0, pmem_unmap(addr, mapped_len));
+
+  for (auto sum : sums) {
+    EXPECT_EQ(0xA5u * (slice / block_size_), sum);
+  }
+
+  /* Step 3 */
+  RecordLocality();
+  report::Record("is_pmem", is_pmem);
+  report::Record("read_bandwidth_MiBps", ToMiBps(mapped_len, time_us));
+}
+
+/**
+ * NumaLocality.POOLSET_REPLICA_WRITE_THROUGHPUT
+ * Measuring write throughput of obj pool with master replica on local NUMA
+ * node and second replica placed on local or remote node
+ * \test
+ *          \li \c Step1. Create poolset file with replica on selected node and
+ *          create obj pool / SUCCESS
+ *          \li \c Step2. Write root object in blocks from threads pinned to
+ *          local node / SUCCESS
+ *          \li \c Step3. Record throughput / SUCCESS
+ */
+TEST_P(NumaLocality, POOLSET_REPLICA_WRITE_THROUGHPUT) {
+  if (!IsConfigured()) {
+    return;
+  }
+
+  /* Step 1 */
+  const std::string part_size =
+      std::to_string(NUMA_POOL_SIZE / MEBIBYTE) + "M";
+  Poolset poolset{GetLocalDir().path,
+                  "numa.set",
+                  {{"PMEMPOOLSET", part_size},
+                   {"REPLICA",
+                    part_size + " " + GetPoolDir().path + "replica.part0"}}};
+  ASSERT_EQ(0, PoolsetManagement().CreatePoolsetFile(poolset));
+
+  PMEMobjpool *pop =
+      pmemobj_create(poolset.GetFullPath().c_str(), LAYOUT.c_str(), 0, 0644);
+  ASSERT_NE(nullptr, pop) << pmemobj_errormsg();
+
+  const size_t slice = NUMA_POOL_SIZE / 2 / threads_count_;
+  char *root = static_cast<char *>(
+      pmemobj_direct(pmemobj_root(pop, slice * threads_count_)));
+  ASSERT_NE(nullptr, root) << pmemobj_errormsg();
+
+  /* Step 2 */
+  long long time_us = RunPinned([&](unsigned thread) {
+    std::vector<char> block(block_size_, static_cast<char>(thread + 1));
+    char *begin = root + thread * slice;
+    for (size_t off = 0; off + block_size_ <= slice; off += block_size_) {
+      pmemobj_memcpy_persist(pop, begin + off, block.data(), block_size_);
+    }
+  });
+  pmemobj_close(pop);
+
+  /* Step 3 */
+  RecordLocality();
+  report::Record("write_throughput_MiBps",
+                 ToMiBps(slice * threads_count_, time_us));
+}
+
+INSTANTIATE_TEST_CASE_P(Benchmarks, NumaLocality,
+                        ::testing::Values(Locality::Local, Locality::Remote));
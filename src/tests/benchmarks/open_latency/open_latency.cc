@@ -0,0 +1,230 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "open_latency.h"
+#include "timer/timer.h"
+
+void PrintTo(const PoolLayout &layout, std::ostream *os) {
+  *os << struct_utils::POOL_TYPES[struct_utils::ConvertEnum<int>(
+             layout.pool_type)]
+      << layout.parts << " parts, " << layout.replicas << " replicas";
+}
+
+void PrintTo(Prefault prefault, std::ostream *os) {
+  switch (prefault) {
+    case Prefault::None:
+      *os << "no prefault";
+      break;
+    case Prefault::AtCreate:
+      *os << "prefault.at_create";
+      break;
+    case Prefault::AtOpen:
+      *os << "prefault.at_open";
+      break;
+  }
+}
+
+void PoolOpenLatency::SetUp() {
+  std::tie(layout_, prefault_) = GetParam();
+
+  std::vector<std::vector<std::string>> content;
+  for (unsigned replica = 0; replica <= layout_.replicas; ++replica) {
+    content.emplace_back(std::vector<std::string>{
+        replica == 0 ? "PMEMPOOLSET" : "REPLICA"});
+    content.back().insert(
+        content.back().end(), layout_.parts,
+        std::to_string(OPEN_LATENCY_PART_SIZE / MEBIBYTE) + "M");
+  }
+
+  poolset_.reset(new Poolset{local_config->GetTestDir(), "pool.set", content});
+  ASSERT_EQ(0, PoolsetManagement().CreatePoolsetFile(*poolset_));
+
+  ASSERT_EQ(0, SetPrefault("prefault.at_create",
+                           prefault_ == Prefault::AtCreate ? 1 : 0));
+  ASSERT_EQ(0, SetPrefault("prefault.at_open",
+                           prefault_ == Prefault::AtOpen ? 1 : 0));
+}
+
+size_t PoolOpenLatency::GetPoolSize(const PoolLayout &layout) {
+  return OPEN_LATENCY_PART_SIZE * layout.parts * (layout.replicas + 1);
+}
+
+int PoolOpenLatency::SetPrefault(const std::string &name, int value) const {
+  int ret = -1;
+
+  switch (layout_.pool_type) {
+    case PoolType::Obj:
+      ret = pmemobj_ctl_set(nullptr, name.c_str(), &value);
+      break;
+    case PoolType::Blk:
+      ret = pmemblk_ctl_set(nullptr, name.c_str(), &value);
+      break;
+    case PoolType::Log:
+      ret = pmemlog_ctl_set(nullptr, name.c_str(), &value);
+      break;
+    default:
+      break;
+  }
+
+  if (ret != 0) {
+    std::cerr << "Unable to set " << name << std::endl;
+  }
+
+  return ret;
+}
+
+std::vector<std::string> PoolOpenLatency::GetFiles() const {
+  std::vector<std::string> files{poolset_->GetFullPath()};
+
+  for (const auto &part : poolset_->GetParts()) {
+    files.emplace_back(part.GetPath());
+  }
+
+  return files;
+}
+
+int PoolOpenLatency::CreatePool() {
+  const char *path = poolset_->GetFullPath().c_str();
+
+  switch (layout_.pool_type) {
+    case PoolType::Obj: {
+      PMEMobjpool *pop = pmemobj_create(path, nullptr, 0, 0644);
+      if (pop == nullptr) {
+        std::cerr << pmemobj_errormsg() << std::endl;
+        return -1;
+      }
+      pmemobj_root(pop, block_size_);
+      pmemobj_close(pop);
+      break;
+    }
+    case PoolType::Blk: {
+      PMEMblkpool *pbp = pmemblk_create(path, block_size_, 0, 0644);
+      if (pbp == nullptr) {
+        std::cerr << pmemblk_errormsg() << std::endl;
+        return -1;
+      }
+      pmemblk_close(pbp);
+      break;
+    }
+    case PoolType::Log: {
+      PMEMlogpool *plp = pmemlog_create(path, 0, 0644);
+      if (plp == nullptr) {
+        std::cerr << pmemlog_errormsg() << std::endl;
+        return -1;
+      }
+      pmemlog_close(plp);
+      break;
+    }
+    default:
+      return -1;
+  }
+
+  return 0;
+}
+
+int PoolOpenLatency::OpenAndWrite(long long &open_time_us,
+                                  long long &write_time_us) {
+  const char *path = poolset_->GetFullPath().c_str();
+  std::vector<char> buffer(block_size_, 1);
+  Timer timer;
+
+  switch (layout_.pool_type) {
+    case PoolType::Obj: {
+      timer.Start();
+      PMEMobjpool *pop = pmemobj_open(path, nullptr);
+      timer.Stop();
+      if (pop == nullptr) {
+        std::cerr << pmemobj_errormsg() << std::endl;
+        return -1;
+      }
+      open_time_us = timer.GetElapsed();
+
+      timer.Start();
+      void *root = pmemobj_direct(pmemobj_root(pop, block_size_));
+      pmemobj_memcpy_persist(pop, root, buffer.data(), block_size_);
+      timer.Stop();
+      pmemobj_close(pop);
+      break;
+    }
+    case PoolType::Blk: {
+      timer.Start();
+      PMEMblkpool *pbp = pmemblk_open(path, block_size_);
+      timer.Stop();
+      if (pbp == nullptr) {
+        std::cerr << pmemblk_errormsg() << std::endl;
+        return -1;
+      }
+      open_time_us = timer.GetElapsed();
+
+      timer.Start();
+      int ret = pmemblk_write(pbp, buffer.data(), 0);
+      timer.Stop();
+      pmemblk_close(pbp);
+      if (ret != 0) {
+        std::cerr << pmemblk_errormsg() << std::endl;
+        return -1;
+      }
+      break;
+    }
+    case PoolType::Log: {
+      timer.Start();
+      PMEMlogpool *plp = pmemlog_open(path);
+      timer.Stop();
+      if (plp == nullptr) {
+        std::cerr << pmemlog_errormsg() << std::endl;
+        return -1;
+      }
+      open_time_us = timer.GetElapsed();
+
+      timer.Start();
+      int ret = pmemlog_append(plp, buffer.data(), block_size_);
+      timer.Stop();
+      pmemlog_close(plp);
+      if (ret != 0) {
+        std::cerr << pmemlog_errormsg() << std::endl;
+        return -1;
+      }
+      break;
+    }
+    default:
+      return -1;
+  }
+
+  write_time_us = timer.GetElapsed();
+  return 0;
+}
+
+void PoolOpenLatency::TearDown() {
+  SetPrefault("prefault.at_create", 0);
+  SetPrefault("prefault.at_open", 0);
+  ApiC::CleanDirectory(local_config->GetTestDir());
+}
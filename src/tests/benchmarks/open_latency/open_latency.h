@@ -0,0 +1,89 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_BENCHMARKS_OPEN_LATENCY_OPEN_LATENCY_H_
+#define PMDK_TESTS_SRC_TESTS_BENCHMARKS_OPEN_LATENCY_OPEN_LATENCY_H_
+
+#include <memory>
+#include <ostream>
+#include <tuple>
+#include <vector>
+#include "configXML/local_configuration.h"
+#include "gtest/gtest.h"
+#include "poolset/poolset.h"
+#include "poolset/poolset_management.h"
+#include "report.h"
+#include "structures.h"
+
+extern std::unique_ptr<LocalConfiguration> local_config;
+
+struct PoolLayout {
+  PoolType pool_type;
+  unsigned parts;
+  unsigned replicas;
+};
+
+enum class Prefault { None, AtCreate, AtOpen };
+
+void PrintTo(const PoolLayout &layout, std::ostream *os);
+void PrintTo(Prefault prefault, std::ostream *os);
+
+static const size_t OPEN_LATENCY_PART_SIZE = 64 * MEBIBYTE;
+
+/*
+ * PoolOpenLatency -- creates pool described by poolset with given number of
+ * parts and replicas, with prefault.at_create or prefault.at_open ctl knob
+ * enabled, and measures its open time and time of first write.
+ */
+class PoolOpenLatency
+    : public ::testing::TestWithParam<std::tuple<PoolLayout, Prefault>> {
+ private:
+  int SetPrefault(const std::string &name, int value) const;
+
+ public:
+  const size_t block_size_ = 4 * KIBIBYTE;
+  PoolLayout layout_;
+  Prefault prefault_;
+  std::unique_ptr<Poolset> poolset_;
+
+  /* summed size of parts of all replicas */
+  static size_t GetPoolSize(const PoolLayout &layout);
+
+  std::vector<std::string> GetFiles() const;
+  int CreatePool();
+  int OpenAndWrite(long long &open_time_us, long long &write_time_us);
+
+  void SetUp() override;
+  void TearDown() override;
+};
+
+#endif  // !PMDK_TESTS_SRC_TESTS_BENCHMARKS_OPEN_LATENCY_OPEN_LATENCY_H_
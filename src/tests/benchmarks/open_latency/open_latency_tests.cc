@@ -0,0 +1,104 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cache_mode/cache_mode.h"
+#include "open_latency.h"
+#include "test_runner/footprint.h"
+#include "timer/timer.h"
+
+namespace {
+/* only obj pools support replicas */
+std::vector<PoolLayout> GetLayouts() {
+  return {PoolLayout{PoolType::Obj, 1, 0}, PoolLayout{PoolType::Obj, 4, 0},
+          PoolLayout{PoolType::Obj, 1, 1}, PoolLayout{PoolType::Obj, 1, 2},
+          PoolLayout{PoolType::Obj, 4, 2}, PoolLayout{PoolType::Blk, 1, 0},
+          PoolLayout{PoolType::Blk, 4, 0}, PoolLayout{PoolType::Log, 1, 0},
+          PoolLayout{PoolType::Log, 4, 0}};
+}
+
+std::vector<Prefault> GetPrefaults() {
+  return {Prefault::None, Prefault::AtCreate, Prefault::AtOpen};
+}
+
+/* parameters are combined with prefault varying fastest */
+const Footprint open_latency_footprint{
+    "Benchmarks/PoolOpenLatency", [](size_t index) {
+      return PoolOpenLatency::GetPoolSize(
+          GetLayouts().at(index / GetPrefaults().size()));
+    }};
+}  // namespace
+
+/**
+ * PoolOpenLatency.OPEN_AND_FIRST_WRITE_LATENCY
+ * Measuring create, open and first write latency of pools described by
+ * poolsets with different number of parts and replicas, with and without
+ * prefaulting
+ * \test
+ *          \li \c Step1. Create pool with selected prefault ctl knob
+ *          enabled and record create time / SUCCESS
+ *          \li \c Step2. For each selected cache state open pool, write
+ *          one block and record open time, write time and number of page
+ *          faults during open / SUCCESS
+ */
+TEST_P(PoolOpenLatency, OPEN_AND_FIRST_WRITE_LATENCY) {
+  /* Step 1 */
+  Timer timer;
+  timer.Start();
+  ASSERT_EQ(0, CreatePool());
+  timer.Stop();
+
+  report::Record("pool_size", GetPoolSize(layout_));
+  report::Record("create_time_us", timer.GetElapsed());
+
+  /* Step 2 */
+  for (CacheState state : CacheMode::GetStates()) {
+    const std::string prefix = CacheMode::GetName(state) + "_";
+    long long open_time_us = 0, write_time_us = 0;
+    long long minor_before = 0, major_before = 0;
+    long long minor_after = 0, major_after = 0;
+
+    ASSERT_EQ(0, CacheMode::Prepare(state, GetFiles()));
+    ASSERT_EQ(0, ApiC::GetPageFaults(minor_before, major_before));
+    ASSERT_EQ(0, OpenAndWrite(open_time_us, write_time_us));
+    ASSERT_EQ(0, ApiC::GetPageFaults(minor_after, major_after));
+
+    report::Record(prefix + "open_time_us", open_time_us);
+    report::Record(prefix + "first_write_time_us", write_time_us);
+    report::Record(prefix + "minor_faults", minor_after - minor_before);
+    report::Record(prefix + "major_faults", major_after - major_before);
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Benchmarks, PoolOpenLatency,
+    ::testing::Combine(::testing::ValuesIn(GetLayouts()),
+                       ::testing::ValuesIn(GetPrefaults())));
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_BENCHMARKS_PATTERN_FILL_PATTERN_FILL_H_
+#define PMDK_TESTS_SRC_TESTS_BENCHMARKS_PATTERN_FILL_PATTERN_FILL_H_
+
+#include <stdint.h>
+#include <memory>
+#include "configXML/local_configuration.h"
+#include "constants.h"
+#include "gtest/gtest.h"
+#include "report.h"
+
+extern std::unique_ptr<LocalConfiguration> local_config;
+
+/*
+ * PatternFill -- fills file on test media with pattern and verifies it,
+ * using number of threads given as parameter.
+ */
+class PatternFill : public ::testing::TestWithParam<unsigned> {
+ public:
+  const std::string file_path_ =
+      local_config->GetTestDir() + "pattern.file";
+  const size_t file_size_ = GIGIBYTE;
+  const uint64_t seed_ = 0x5EED;
+
+  static double GetBandwidth(size_t size, long long time_us);
+
+  void TearDown() override;
+};
+
+#endif  // !PMDK_TESTS_SRC_TESTS_BENCHMARKS_PATTERN_FILL_PATTERN_FILL_H_
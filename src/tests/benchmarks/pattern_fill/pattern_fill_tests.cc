@@ -0,0 +1,100 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <libpmem.h>
+#include "pattern_fill.h"
+#include "test_utils/pattern_utils.h"
+#include "test_runner/footprint.h"
+#include "timer/timer.h"
+
+namespace {
+const Footprint pattern_fill_footprint{"Benchmarks/PatternFill", GIGIBYTE};
+}  // namespace
+
+/**
+ * PatternFill.FILL_AND_VERIFY_BANDWIDTH
+ * Measuring bandwidth of filling file on test media with pattern and of
+ * verifying it, depending on number of threads
+ * \test
+ *          \li \c Step1. Create and map file / SUCCESS
+ *          \li \c Step2. Fill file with pattern and persist it, record fill
+ *          bandwidth / SUCCESS
+ *          \li \c Step3. Verify pattern and record verify bandwidth
+ *          / SUCCESS
+ *          \li \c Step4. Make sure that whole file matches pattern
+ *          \li \c Step5. Corrupt single byte and make sure that verification
+ *          reports its offset
+ */
+TEST_P(PatternFill, FILL_AND_VERIFY_BANDWIDTH) {
+  const unsigned threads = GetParam();
+  size_t mapped_len = 0;
+  int is_pmem = 0;
+  Timer timer;
+
+  /* Step 1 */
+  char *addr = static_cast<char *>(
+      pmem_map_file(file_path_.c_str(), file_size_, PMEM_FILE_CREATE, 0644,
+                    &mapped_len, &is_pmem));
+  ASSERT_NE(nullptr, addr) << pmem_errormsg();
+
+  report::Record("threads", threads);
+  report::Record("is_pmem", is_pmem);
+
+  /* Step 2 */
+  timer.Start();
+  int ret = pattern_utils::Fill(addr, mapped_len, seed_, threads);
+  timer.Stop();
+  EXPECT_EQ(0, ret);
+  report::Record("fill_MiBps", GetBandwidth(mapped_len, timer.GetElapsed()));
+
+  /* Step 3 */
+  timer.Start();
+  long long mismatch_offset = pattern_utils::Verify(addr, mapped_len, seed_,
+                                                    threads);
+  timer.Stop();
+  report::Record("verify_MiBps",
+                 GetBandwidth(mapped_len, timer.GetElapsed()));
+
+  /* Step 4 */
+  EXPECT_EQ(-1, mismatch_offset);
+
+  /* Step 5 */
+  const size_t corrupted_offset = mapped_len / 2 + 3;
+  addr[corrupted_offset] ^= 1;
+  EXPECT_EQ(static_cast<long long>(corrupted_offset),
+            pattern_utils::Verify(addr, mapped_len, seed_, threads));
+
+  pmem_unmap(addr, mapped_len);
+}
+
+INSTANTIATE_TEST_CASE_P(Benchmarks, PatternFill,
+                        ::testing::Values(1u, 2u, 4u, 8u, 16u));
@@ -0,0 +1,203 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef __linux__
+
+#include "recovery_time.h"
+#include <errno.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <thread>
+#include <vector>
+
+void PrintTo(KillPoint kill_point, std::ostream *os) {
+  *os << (kill_point == KillPoint::AfterSnapshot ? "after snapshot"
+                                                 : "after allocation");
+}
+
+void RecoveryTime::SetUp() {
+  std::tie(undo_size_, threads_count_, kill_point_) = GetParam();
+
+  PMEMobjpool *pop =
+      pmemobj_create(pool_path_.c_str(), nullptr,
+                     GetPoolSize(undo_size_, threads_count_), 0644);
+  ASSERT_NE(nullptr, pop) << pmemobj_errormsg();
+  ASSERT_FALSE(OID_IS_NULL(pmemobj_root(pop, undo_size_ * threads_count_)))
+      << pmemobj_errormsg();
+  pmemobj_close(pop);
+}
+
+size_t RecoveryTime::GetPoolSize(size_t undo_size, unsigned threads_count) {
+  /* root object, undo logs and allocations with space for heap metadata */
+  return threads_count *
+             (3 * undo_size + RECOVERY_ALLOCS_COUNT * RECOVERY_ALLOC_SIZE) +
+         64 * MEBIBYTE;
+}
+
+void RecoveryTime::RunTransaction(PMEMobjpool *pop, unsigned thread,
+                                  int fd) const {
+  PMEMoid root = pmemobj_root(pop, undo_size_ * threads_count_);
+  char *region =
+      static_cast<char *>(pmemobj_direct(root)) + thread * undo_size_;
+  const char signal = 1;
+
+  if (pmemobj_tx_begin(pop, nullptr, TX_PARAM_NONE) != 0) {
+    _exit(1);
+  }
+
+  for (size_t offset = 0; offset < undo_size_; offset += range_size_) {
+    if (pmemobj_tx_add_range(root, thread * undo_size_ + offset,
+                             range_size_) != 0) {
+      _exit(1);
+    }
+  }
+  pmemobj_memset_persist(pop, region, 0xFF, undo_size_);
+
+  if (kill_point_ == KillPoint::AfterAllocation) {
+    for (unsigned i = 0; i < RECOVERY_ALLOCS_COUNT; ++i) {
+      if (OID_IS_NULL(
+              pmemobj_tx_alloc(RECOVERY_ALLOC_SIZE, alloc_type_num_))) {
+        _exit(1);
+      }
+    }
+  }
+
+  if (write(fd, &signal, sizeof(signal)) != sizeof(signal)) {
+    _exit(1);
+  }
+
+  /* wait inside of the transaction to be killed */
+  while (true) {
+    pause();
+  }
+}
+
+void RecoveryTime::RunChild(int fd) const {
+  PMEMobjpool *pop = pmemobj_open(pool_path_.c_str(), nullptr);
+
+  if (pop == nullptr) {
+    _exit(1);
+  }
+
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < threads_count_; ++i) {
+    threads.emplace_back(&RecoveryTime::RunTransaction, this, pop, i, fd);
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  _exit(1);
+}
+
+int RecoveryTime::CrashInTransactions() {
+  int fds[2];
+
+  if (pipe(fds) != 0) {
+    std::cerr << "pipe failed: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  pid_t pid = fork();
+
+  if (pid == -1) {
+    std::cerr << "fork failed: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  if (pid == 0) {
+    close(fds[0]);
+    RunChild(fds[1]);
+  }
+
+  close(fds[1]);
+
+  unsigned ready = 0;
+  char signal;
+  while (ready < threads_count_) {
+    ssize_t ret = read(fds[0], &signal, sizeof(signal));
+    if (ret == -1 && errno == EINTR) {
+      continue;
+    }
+    if (ret != sizeof(signal)) {
+      break;
+    }
+    ++ready;
+  }
+  close(fds[0]);
+
+  kill(pid, SIGKILL);
+
+  int status = 0;
+  while (waitpid(pid, &status, 0) == -1 && errno == EINTR) {
+  }
+
+  if (ready != threads_count_ || !WIFSIGNALED(status)) {
+    std::cerr << "Child process failed before reaching kill point"
+              << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+int RecoveryTime::VerifyRolledBack(PMEMobjpool *pop) const {
+  const char *root = static_cast<const char *>(
+      pmemobj_direct(pmemobj_root(pop, undo_size_ * threads_count_)));
+
+  for (size_t i = 0; i < undo_size_ * threads_count_; ++i) {
+    if (root[i] != 0) {
+      std::cerr << "Transaction was not rolled back at offset " << i
+                << std::endl;
+      return -1;
+    }
+  }
+
+  for (PMEMoid oid = pmemobj_first(pop); !OID_IS_NULL(oid);
+       oid = pmemobj_next(oid)) {
+    if (pmemobj_type_num(oid) == alloc_type_num_) {
+      std::cerr << "Allocation of interrupted transaction was not rolled back"
+                << std::endl;
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+void RecoveryTime::TearDown() {
+  ApiC::CleanDirectory(local_config->GetTestDir());
+}
+
+#endif  // __linux__
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_BENCHMARKS_RECOVERY_TIME_RECOVERY_TIME_H_
+#define PMDK_TESTS_SRC_TESTS_BENCHMARKS_RECOVERY_TIME_RECOVERY_TIME_H_
+
+#include <libpmemobj.h>
+#include <memory>
+#include <ostream>
+#include <tuple>
+#include "configXML/local_configuration.h"
+#include "constants.h"
+#include "gtest/gtest.h"
+#include "report.h"
+
+extern std::unique_ptr<LocalConfiguration> local_config;
+
+/* point of transaction at which child process is killed */
+enum class KillPoint { AfterSnapshot, AfterAllocation };
+
+void PrintTo(KillPoint kill_point, std::ostream *os);
+
+/* size and number of objects allocated by each transaction */
+static const size_t RECOVERY_ALLOC_SIZE = 4 * MEBIBYTE;
+static const unsigned RECOVERY_ALLOCS_COUNT = 4;
+
+/*
+ * RecoveryTime -- runs large transactions in threads of a forked child
+ * process and kills it with SIGKILL when all threads reach given point of
+ * their transactions. Parameters are size of data snapshotted in each
+ * transaction (i.e. size of undo log), number of threads and kill point.
+ */
+class RecoveryTime : public ::testing::TestWithParam<
+                         std::tuple<size_t, unsigned, KillPoint>> {
+ private:
+  void RunTransaction(PMEMobjpool *pop, unsigned thread, int fd) const;
+  void RunChild(int fd) const;
+
+ public:
+  const std::string pool_path_ = local_config->GetTestDir() + "pool.file";
+  const size_t range_size_ = 4 * KIBIBYTE;
+  const uint64_t alloc_type_num_ = 1;
+  size_t undo_size_;
+  unsigned threads_count_;
+  KillPoint kill_point_;
+
+  static size_t GetPoolSize(size_t undo_size, unsigned threads_count);
+  int CrashInTransactions();
+  int VerifyRolledBack(PMEMobjpool *pop) const;
+
+  void SetUp() override;
+  void TearDown() override;
+};
+
+#endif  // !PMDK_TESTS_SRC_TESTS_BENCHMARKS_RECOVERY_TIME_RECOVERY_TIME_H_
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef __linux__
+
+#include "pmempool_output/pmempool_output.h"
+#include "recovery_time.h"
+#include "shell/i_shell.h"
+#include "test_runner/footprint.h"
+#include "test_utils/file_utils.h"
+#include "timer/timer.h"
+
+namespace {
+std::vector<size_t> GetUndoSizes() {
+  return {MEBIBYTE, 8 * MEBIBYTE, 32 * MEBIBYTE};
+}
+
+std::vector<unsigned> GetThreadsCounts() {
+  return {1u, 4u, 8u};
+}
+
+std::vector<KillPoint> GetKillPoints() {
+  return {KillPoint::AfterSnapshot, KillPoint::AfterAllocation};
+}
+
+const Footprint recovery_time_footprint{
+    "Benchmarks/RecoveryTime", [](size_t index) {
+      size_t i = index / GetKillPoints().size();
+      return RecoveryTime::GetPoolSize(
+          GetUndoSizes().at(i / GetThreadsCounts().size()),
+          GetThreadsCounts().at(i % GetThreadsCounts().size()));
+    }};
+}  // namespace
+
+/**
+ * RecoveryTime.RECOVERY_AFTER_CRASH
+ * Measuring time of obj pool recovery after crash of process in the middle
+ * of transactions
+ * \test
+ *          \li \c Step1. Start transactions in threads of child process and
+ *          kill it when all of them reach kill point / SUCCESS
+ *          \li \c Step2. Open pool, which performs recovery, and record open
+ *          time / SUCCESS
+ *          \li \c Step3. Make sure that transactions were rolled back
+ *          \li \c Step4. Make sure that pool is consistent
+ *          \li \c Step5. Record heap statistics of recovered pool reported
+ *          by pmempool info / SUCCESS
+ */
+TEST_P(RecoveryTime, RECOVERY_AFTER_CRASH) {
+  /* Step 1 */
+  ASSERT_EQ(0, CrashInTransactions());
+
+  /* Step 2 */
+  Timer timer;
+  timer.Start();
+  PMEMobjpool *pop = pmemobj_open(pool_path_.c_str(), nullptr);
+  timer.Stop();
+  ASSERT_NE(nullptr, pop) << pmemobj_errormsg();
+
+  report::Record("undo_size", undo_size_);
+  report::Record("threads", threads_count_);
+  report::Record("kill_point", ::testing::PrintToString(kill_point_));
+  report::Record("recovery_open_time_us", timer.GetElapsed());
+
+  /* Step 3 */
+  EXPECT_EQ(0, VerifyRolledBack(pop));
+  pmemobj_close(pop);
+
+  /* Step 4 */
+  long long check_time_us = 0;
+  EXPECT_EQ(0, file_utils::CheckConsistency(pool_path_, check_time_us));
+  report::Record("check_time_us", check_time_us);
+
+  /* Step 5 */
+  IShell shell;
+  PoolInfo info;
+  ASSERT_EQ(0, shell.ExecuteCommand("pmempool info -s " + pool_path_)
+                   .GetExitCode());
+
+  timer.Start();
+  ASSERT_EQ(0, PmempoolOutput::ParseInfo(shell.GetLastOutput().GetContent(),
+                                         info));
+  timer.Stop();
+
+  report::Record("info_parse_time_us", timer.GetElapsed());
+  report::Record("objects_count", info.objects_count);
+  report::Record("objects_size", info.objects_size);
+  report::Record("used_zones_count", info.used_zones_count);
+  for (const auto &zone : info.zones) {
+    const std::string *chunks = zone.Find("Number of chunks");
+    if (chunks != nullptr) {
+      report::Record("zone" + std::to_string(zone.id) + "_chunks",
+                     PmempoolOutput::ToNumber(*chunks));
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Benchmarks, RecoveryTime,
+    ::testing::Combine(::testing::ValuesIn(GetUndoSizes()),
+                       ::testing::ValuesIn(GetThreadsCounts()),
+                       ::testing::ValuesIn(GetKillPoints())));
+
+#endif  // __linux__
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "replica_cost.h"
+#include <random>
+#include <vector>
+#include "timer/timer.h"
+
+Poolset ReplicaCost::CreatePoolset(unsigned replicas) const {
+  const std::string part = std::to_string(REPLICA_PART_SIZE / MEBIBYTE) + "M";
+  std::vector<std::vector<std::string>> content{{"PMEMPOOLSET", part}};
+
+  for (unsigned i = 0; i < replicas; ++i) {
+    content.push_back({"REPLICA", part});
+  }
+
+  return Poolset{local_config->GetTestDir(), "pool.set", content};
+}
+
+int ReplicaCost::RunWorkload(PMEMobjpool *pop, WorkloadResult &result) const {
+  const size_t record_size = GetParam();
+  PMEMoid root = pmemobj_root(pop, region_size_);
+  char *region = static_cast<char *>(pmemobj_direct(root));
+
+  if (region == nullptr) {
+    std::cerr << pmemobj_errormsg() << std::endl;
+    return -1;
+  }
+
+  /* the same sequence of records is updated for each number of replicas */
+  std::mt19937_64 generator{0};
+  std::uniform_int_distribution<size_t> record(
+      0, region_size_ / record_size - 1);
+  std::vector<char> buffer(record_size, 0x5A);
+  long long read_bytes = 0, write_bytes_before = 0, write_bytes_after = 0;
+
+  if (ApiC::GetIoCounters(read_bytes, write_bytes_before) != 0) {
+    return -1;
+  }
+
+  Timer timer;
+  timer.Start();
+
+  for (unsigned i = 0; i < ops_count_; ++i) {
+    size_t offset = record(generator) * record_size;
+
+    if (pmemobj_tx_begin(pop, nullptr, TX_PARAM_NONE) != 0) {
+      std::cerr << pmemobj_errormsg() << std::endl;
+      return -1;
+    }
+
+    if (pmemobj_tx_add_range(root, offset, record_size) != 0) {
+      std::cerr << pmemobj_errormsg() << std::endl;
+      pmemobj_tx_end();
+      return -1;
+    }
+
+    memcpy(region + offset, buffer.data(), record_size);
+    pmemobj_tx_commit();
+
+    if (pmemobj_tx_end() != 0) {
+      std::cerr << pmemobj_errormsg() << std::endl;
+      return -1;
+    }
+  }
+
+  timer.Stop();
+
+  if (ApiC::GetIoCounters(read_bytes, write_bytes_after) != 0) {
+    return -1;
+  }
+
+  result.time_us = timer.GetElapsed();
+  result.write_bytes = write_bytes_after - write_bytes_before;
+
+  return 0;
+}
+
+void ReplicaCost::TearDown() {
+  ApiC::CleanDirectory(local_config->GetTestDir());
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_BENCHMARKS_REPLICA_COST_REPLICA_COST_H_
+#define PMDK_TESTS_SRC_TESTS_BENCHMARKS_REPLICA_COST_REPLICA_COST_H_
+
+#include <libpmemobj.h>
+#include <memory>
+#include "configXML/local_configuration.h"
+#include "constants.h"
+#include "gtest/gtest.h"
+#include "poolset/poolset.h"
+#include "poolset/poolset_management.h"
+#include "report.h"
+
+extern std::unique_ptr<LocalConfiguration> local_config;
+
+/* size of each part and maximal number of replicas of tested pools */
+static const size_t REPLICA_PART_SIZE = 128 * MEBIBYTE;
+static const unsigned MAX_REPLICAS = 3;
+
+struct WorkloadResult {
+  long long time_us = 0;
+  long long write_bytes = 0;
+};
+
+/*
+ * ReplicaCost -- runs fixed transactional workload on obj pools described
+ * by poolsets with growing number of replicas. Parameter is size of record
+ * updated by each transaction.
+ */
+class ReplicaCost : public ::testing::TestWithParam<size_t> {
+ public:
+  const unsigned ops_count_ = 20000;
+  const size_t region_size_ = 16 * MEBIBYTE;
+
+  Poolset CreatePoolset(unsigned replicas) const;
+  int RunWorkload(PMEMobjpool *pop, WorkloadResult &result) const;
+
+  void TearDown() override;
+};
+
+#endif  // !PMDK_TESTS_SRC_TESTS_BENCHMARKS_REPLICA_COST_REPLICA_COST_H_
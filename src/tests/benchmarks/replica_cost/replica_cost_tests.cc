@@ -0,0 +1,112 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "replica_cost.h"
+#include "statistics.h"
+#include "test_runner/footprint.h"
+
+namespace {
+/* pool with most replicas, each of single part */
+const Footprint replica_cost_footprint{"Benchmarks/ReplicaCost",
+                                       REPLICA_PART_SIZE * (MAX_REPLICAS + 1)};
+}  // namespace
+
+/**
+ * ReplicaCost.TRANSACTION_COST_PER_REPLICA
+ * Measuring cost of each additional replica for transactional updates of
+ * obj pool
+ * \test
+ *          \li \c Step1. For 0 to MAX_REPLICAS replicas create obj pool
+ *          described by poolset, run workload and record throughput, mean
+ *          latency, bytes written to storage and allocated size of each
+ *          replica / SUCCESS
+ *          \li \c Step2. Record latency and written bytes per additional
+ *          replica fitted to all samples / SUCCESS
+ */
+TEST_P(ReplicaCost, TRANSACTION_COST_PER_REPLICA) {
+  std::vector<double> replicas_counts;
+  std::vector<double> latencies_ns;
+  std::vector<double> written_bytes;
+
+  report::Record("record_size", GetParam());
+  report::Record("ops_count", ops_count_);
+
+  /* Step 1 */
+  for (unsigned replicas = 0; replicas <= MAX_REPLICAS; ++replicas) {
+    Poolset poolset = CreatePoolset(replicas);
+    ASSERT_EQ(0, PoolsetManagement().CreatePoolsetFile(poolset));
+
+    PMEMobjpool *pop =
+        pmemobj_create(poolset.GetFullPath().c_str(), nullptr, 0, 0644);
+    ASSERT_NE(nullptr, pop) << pmemobj_errormsg();
+
+    WorkloadResult result;
+    int ret = RunWorkload(pop, result);
+    pmemobj_close(pop);
+    ASSERT_EQ(0, ret);
+
+    const std::string prefix = "replicas_" + std::to_string(replicas) + "_";
+    double latency_ns = static_cast<double>(result.time_us) * 1000 / ops_count_;
+
+    report::Record(prefix + "ops_per_s",
+                   result.time_us > 0 ? ops_count_ * 1000000.0 / result.time_us
+                                      : 0);
+    report::Record(prefix + "mean_latency_ns", latency_ns);
+    report::Record(prefix + "write_bytes", result.write_bytes);
+
+    for (unsigned i = 0; i < poolset.GetReplicas().size(); ++i) {
+      long long allocated = 0;
+      for (const auto &part : poolset.GetReplica(i).GetParts()) {
+        allocated += ApiC::GetAllocatedSize(part.GetPath());
+      }
+      report::Record(prefix + "replica" + std::to_string(i) + "_allocated",
+                     allocated);
+    }
+
+    replicas_counts.emplace_back(replicas);
+    latencies_ns.emplace_back(latency_ns);
+    written_bytes.emplace_back(static_cast<double>(result.write_bytes));
+
+    ApiC::CleanDirectory(local_config->GetTestDir());
+  }
+
+  /* Step 2 */
+  report::Record(
+      "latency_penalty_ns_per_replica",
+      statistics::FitLinear(replicas_counts, latencies_ns).slope);
+  report::Record(
+      "write_bytes_per_replica",
+      statistics::FitLinear(replicas_counts, written_bytes).slope);
+}
+
+INSTANTIATE_TEST_CASE_P(Benchmarks, ReplicaCost,
+                        ::testing::Values(64, 256, 4 * KIBIBYTE));
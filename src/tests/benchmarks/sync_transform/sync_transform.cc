@@ -0,0 +1,97 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sync_transform.h"
+#include "timer/timer.h"
+
+Poolset SyncTransform::CreatePoolset(const std::string &name,
+                                     size_t pool_size,
+                                     bool with_replica) const {
+  const unsigned parts = std::get<1>(GetParam());
+  const std::string part =
+      std::to_string(pool_size / parts / MEBIBYTE) + "M";
+  std::vector<std::string> master{"PMEMPOOLSET"};
+  std::vector<std::string> replica{"REPLICA"};
+
+  for (unsigned i = 0; i < parts; ++i) {
+    master.emplace_back(part);
+    replica.emplace_back(part);
+  }
+
+  std::vector<std::vector<std::string>> content{master};
+  if (with_replica) {
+    content.emplace_back(replica);
+  }
+
+  return Poolset{local_config->GetTestDir(), name, content};
+}
+
+int SyncTransform::SyncPool(const Poolset &poolset, long long &time_us) {
+  Timer timer;
+  timer.Start();
+
+  if (std::get<0>(GetParam()) == Interface::CLI) {
+    output_ = shell_.ExecuteCommand("pmempool sync " + poolset.GetFullPath());
+  } else {
+    int ret = pmempool_sync(poolset.GetFullPath().c_str(), 0);
+    output_ = Output<>(ret, ret == 0 ? "" : pmempool_errormsg());
+  }
+
+  timer.Stop();
+  time_us = timer.GetElapsed();
+
+  return output_.GetExitCode();
+}
+
+int SyncTransform::TransformPool(const Poolset &in, const Poolset &out,
+                                 long long &time_us) {
+  Timer timer;
+  timer.Start();
+
+  if (std::get<0>(GetParam()) == Interface::CLI) {
+    output_ = shell_.ExecuteCommand("pmempool transform " + in.GetFullPath() +
+                                    " " + out.GetFullPath());
+  } else {
+    int ret = pmempool_transform(in.GetFullPath().c_str(),
+                                 out.GetFullPath().c_str(), 0);
+    output_ = Output<>(ret, ret == 0 ? "" : pmempool_errormsg());
+  }
+
+  timer.Stop();
+  time_us = timer.GetElapsed();
+
+  return output_.GetExitCode();
+}
+
+void SyncTransform::TearDown() {
+  ApiC::CleanDirectory(local_config->GetTestDir());
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_BENCHMARKS_SYNC_TRANSFORM_SYNC_TRANSFORM_H_
+#define PMDK_TESTS_SRC_TESTS_BENCHMARKS_SYNC_TRANSFORM_SYNC_TRANSFORM_H_
+
+#include <libpmempool.h>
+#include <memory>
+#include <tuple>
+#include <vector>
+#include "configXML/local_configuration.h"
+#include "gtest/gtest.h"
+#include "output/output.h"
+#include "poolset/poolset.h"
+#include "poolset/poolset_management.h"
+#include "report.h"
+#include "shell/i_shell.h"
+#include "structures.h"
+
+extern std::unique_ptr<LocalConfiguration> local_config;
+
+class SyncTransform
+    : public ::testing::TestWithParam<std::tuple<Interface, unsigned>> {
+ private:
+  Output<> output_;
+
+ public:
+  IShell shell_;
+  PoolsetManagement p_mgmt_;
+  const std::vector<size_t> pool_sizes_{64 * MEBIBYTE, 256 * MEBIBYTE,
+                                        GIGIBYTE};
+
+  /* part of each pool filled with data before measurements */
+  const unsigned data_fraction_ = 4;
+
+  const std::string &GetOutputContent() const {
+    return output_.GetContent();
+  }
+
+  Poolset CreatePoolset(const std::string &name, size_t pool_size,
+                        bool with_replica) const;
+  int SyncPool(const Poolset &poolset, long long &time_us);
+  int TransformPool(const Poolset &in, const Poolset &out, long long &time_us);
+
+  void TearDown() override;
+};
+
+#endif  // !PMDK_TESTS_SRC_TESTS_BENCHMARKS_SYNC_TRANSFORM_SYNC_TRANSFORM_H_
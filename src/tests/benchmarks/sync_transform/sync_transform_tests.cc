@@ -0,0 +1,113 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pool_data.h"
+#include "statistics.h"
+#include "sync_transform.h"
+#include "test_runner/footprint.h"
+
+namespace {
+/* the largest pool with replica */
+const Footprint sync_transform_footprint{"Benchmarks/SyncTransform",
+                                         2 * GIGIBYTE};
+}  // namespace
+
+/**
+ * SyncTransform.HEAL_AND_TRANSFORM_TIME
+ * Measuring time of healing removed replica with pmempool sync and time of
+ * removing and adding replica with pmempool transform, depending on pool size
+ * and number of parts
+ * \test
+ *          \li \c Step1. For each pool size create obj pool with replica and
+ *          fill part of it with data / SUCCESS
+ *          \li \c Step2. Remove replica parts and heal them with pmempool
+ *          sync, record sync time / SUCCESS
+ *          \li \c Step3. Remove replica with pmempool transform and record
+ *          transform time / SUCCESS
+ *          \li \c Step4. Add replica back with pmempool transform, record
+ *          transform time and make sure that data in pool is intact
+ *          / SUCCESS
+ *          \li \c Step5. Record heal time per GiB of pool fitted to all
+ *          samples / SUCCESS
+ */
+TEST_P(SyncTransform, HEAL_AND_TRANSFORM_TIME) {
+  std::vector<double> sizes_gib;
+  std::vector<double> heal_times_ms;
+
+  report::Record("parts", std::get<1>(GetParam()));
+
+  for (size_t pool_size : pool_sizes_) {
+    const std::string prefix =
+        "size_" + std::to_string(pool_size / MEBIBYTE) + "M_";
+    const size_t data_size = pool_size / data_fraction_;
+    Poolset with_replica = CreatePoolset("pool.set", pool_size, true);
+    Poolset without_replica =
+        CreatePoolset("pool_no_replica.set", pool_size, false);
+    long long time_us = 0;
+
+    /* Step 1 */
+    ASSERT_EQ(0, p_mgmt_.CreatePoolsetFile(with_replica));
+    ASSERT_EQ(0, p_mgmt_.CreatePoolsetFile(without_replica));
+    ASSERT_EQ(0,
+              pool_data::CreateObjPool(with_replica.GetFullPath(), data_size));
+
+    /* Step 2 */
+    ASSERT_EQ(0, p_mgmt_.RemoveReplica(with_replica.GetReplica(1)));
+    ASSERT_EQ(0, SyncPool(with_replica, time_us)) << GetOutputContent();
+    report::Record(prefix + "sync_heal_us", time_us);
+    sizes_gib.emplace_back(static_cast<double>(pool_size) / GIGIBYTE);
+    heal_times_ms.emplace_back(static_cast<double>(time_us) / 1000);
+
+    /* Step 3 */
+    ASSERT_EQ(0, TransformPool(with_replica, without_replica, time_us))
+        << GetOutputContent();
+    report::Record(prefix + "transform_remove_replica_us", time_us);
+
+    /* Step 4 */
+    ASSERT_EQ(0, TransformPool(without_replica, with_replica, time_us))
+        << GetOutputContent();
+    report::Record(prefix + "transform_add_replica_us", time_us);
+    EXPECT_EQ(0,
+              pool_data::VerifyObjPool(with_replica.GetFullPath(), data_size));
+
+    ApiC::CleanDirectory(local_config->GetTestDir());
+  }
+
+  /* Step 5 */
+  report::Record("sync_heal_ms_per_gib",
+                 statistics::FitLinear(sizes_gib, heal_times_ms).slope);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Benchmarks, SyncTransform,
+    ::testing::Combine(::testing::Values(Interface::CLI, Interface::API),
+                       ::testing::Values(1u, 4u)));
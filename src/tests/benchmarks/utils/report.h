@@ -0,0 +1,69 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_BENCHMARKS_UTILS_REPORT_H_
+#define PMDK_TESTS_SRC_TESTS_BENCHMARKS_UTILS_REPORT_H_
+
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include "gtest/gtest.h"
+
+namespace report {
+/*
+ * Record -- stores benchmark result as a property of currently running test
+ * (included in --gtest_output report) and prints it.
+ */
+static inline void Record(const std::string &key, const std::string &value) {
+  ::testing::Test::RecordProperty(key, value);
+  std::cout << "[  RESULT  ] " << key << ": " << value << std::endl;
+}
+
+template <typename T, typename = typename std::enable_if<
+                          std::is_arithmetic<T>::value>::type>
+static inline void Record(const std::string &key, T value) {
+  Record(key, std::to_string(value));
+}
+
+/*
+ * Skip -- marks currently running test as skipped with "skipped" property
+ * holding the reason, and prints it. Google Test 1.8 has no notion of
+ * skipped tests, so the test has to return right after that and is
+ * reported as passed.
+ */
+static inline void Skip(const std::string &reason) {
+  ::testing::Test::RecordProperty("skipped", reason);
+  std::cout << "[ SKIPPED  ] " << reason << std::endl;
+}
+}  // namespace report
+
+#endif  // !PMDK_TESTS_SRC_TESTS_BENCHMARKS_UTILS_REPORT_H_
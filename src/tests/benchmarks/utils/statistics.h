@@ -0,0 +1,73 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_BENCHMARKS_UTILS_STATISTICS_H_
+#define PMDK_TESTS_SRC_TESTS_BENCHMARKS_UTILS_STATISTICS_H_
+
+#include <vector>
+
+namespace statistics {
+struct LinearFit {
+  double intercept = 0;
+  double slope = 0;
+};
+
+/*
+ * FitLinear -- least squares fit of y = intercept + slope * x. Returns zeroed
+ * fit when less than two distinct x values are given.
+ */
+static inline LinearFit FitLinear(const std::vector<double> &x,
+                                  const std::vector<double> &y) {
+  LinearFit fit;
+  double n = static_cast<double>(x.size());
+  double sum_x = 0, sum_y = 0, sum_xx = 0, sum_xy = 0;
+
+  for (size_t i = 0; i < x.size(); ++i) {
+    sum_x += x[i];
+    sum_y += y[i];
+    sum_xx += x[i] * x[i];
+    sum_xy += x[i] * y[i];
+  }
+
+  double denominator = n * sum_xx - sum_x * sum_x;
+  if (x.size() < 2 || denominator == 0) {
+    return fit;
+  }
+
+  fit.slope = (n * sum_xy - sum_x * sum_y) / denominator;
+  fit.intercept = (sum_y - fit.slope * sum_x) / n;
+
+  return fit;
+}
+}  // namespace statistics
+
+#endif  // !PMDK_TESTS_SRC_TESTS_BENCHMARKS_UTILS_STATISTICS_H_
@@ -35,6 +35,7 @@
 #include <memory>
 #include "configXML/local_configuration.h"
 #include "gtest/gtest.h"
+#include "test_runner/test_runner.h"
 
 std::unique_ptr<LocalConfiguration> local_config{new LocalConfiguration()};
 
@@ -45,15 +46,23 @@ int main(int argc, char **argv) {
       return -1;
     }
 
+    TestRunner test_runner;
+    if (test_runner.ParseArguments(argc, argv) != 0) {
+      return -1;
+    }
+
     ::testing::InitGoogleTest(&argc, argv);
-    ret = RUN_ALL_TESTS();
+
+    ret = test_runner.Run();
   } catch (const std::exception &e) {
     std::cerr << "Exception was caught: " << e.what() << std::endl;
     ret = -1;
   }
 
-  ApiC::CleanDirectory(local_config->GetTestDir());
-  ApiC::RemoveDirectoryT(local_config->GetTestDir());
+  for (const auto &test_dir : local_config->GetTestDirs()) {
+    ApiC::CleanDirectory(test_dir.path);
+    ApiC::RemoveDirectoryT(test_dir.path);
+  }
 
   return ret;
 }
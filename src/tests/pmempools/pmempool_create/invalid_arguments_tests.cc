@@ -31,6 +31,67 @@
  */
 
 #include "invalid_arguments.h"
+#include "test_runner/footprint.h"
+
+namespace {
+std::vector<PoolInherit> GetInvalidInherits() {
+  return {PoolInherit{{PoolType::Log},
+                      {PoolType::Obj,
+                       {{Option::Inherit, OptionType::Long,
+                         local_config->GetTestDir() + "pool.file"}},
+                       "error: size must be >= " +
+                           std::to_string(PMEMOBJ_MIN_POOL) + " bytes"}}};
+}
+
+std::vector<PoolsetArgs> GetInvalidPoolsets() {
+  return {
+      PoolsetArgs{{PoolType::Obj,
+                   {{Option::Size, OptionType::Long, "30M"}},
+                   "error: -s|--size cannot be used with poolset file"},
+                  Poolset{{"PMEMPOOLSET", "20M"}}},
+      PoolsetArgs{{PoolType::Obj,
+                   {{Option::MaxSize, OptionType::Long}},
+                   "error: -M|--max-size cannot be used with poolset file"},
+                  Poolset{{"PMEMPOOLSET", "20M"}}},
+      PoolsetArgs{{PoolType::Obj,
+                   {{Option::Size, OptionType::Long, "30M"}},
+                   "error: -s|--size cannot be used with poolset file"},
+                  Poolset{{"PMEMPOOLSET", "20M"}}},
+      PoolsetArgs{{PoolType::Obj, "net pool size 7340032 smaller than " +
+                                      std::to_string(PMEMOBJ_MIN_POOL) +
+                                      "\nerror: creating pool file failed"},
+                  Poolset{{"PMEMPOOLSET", "7M"}}},
+      PoolsetArgs{{PoolType::Obj, "net pool size 7340032 smaller than " +
+                                      std::to_string(PMEMOBJ_MIN_POOL) +
+                                      "\nerror: creating pool file failed"},
+                  Poolset{{"PMEMPOOLSET", "20M"}, {"REPLICA", "7M"}}},
+      PoolsetArgs{
+          {PoolType::Log,
+           "replication not supported\nerror: creating pool file failed"},
+          Poolset{{"PMEMPOOLSET", "20M"}, {"REPLICA", "20M"}}},
+      PoolsetArgs{
+          {PoolType::Blk,
+           {{Option::BSize, OptionType::Long, "512"}},
+           " -- replication not supported\nerror: creating pool file failed"},
+          Poolset{{"PMEMPOOLSET", "20M"}, {"REPLICA", "20M"}}}};
+}
+
+/* pmempool rejects arguments before creating pool file */
+const Footprint invalid_footprint{"PmempoolCreateParam/InvalidArgumentsTests",
+                                  0};
+
+const Footprint invalid_inherit_footprint{
+    "PmempoolCreateParam/InvalidInheritTests", [](size_t index) {
+      return struct_utils::GetPoolSize(
+          GetInvalidInherits().at(index).pool_base);
+    }};
+
+/* parts may be created before poolset is rejected */
+const Footprint invalid_poolset_footprint{
+    "PmempoolCreatePoolset/InvalidArgumentsPoolsetTests", [](size_t index) {
+      return file_utils::GetPartsSize(GetInvalidPoolsets().at(index).poolset);
+    }};
+}  // namespace
 
 /**
  * InvalidArgumentsTests.PMEMPOOL_CREATE
@@ -156,14 +217,7 @@ TEST_P(InvalidInheritTests, PMEMPOOL_INHERIT_PROPERTIES) {
 }
 
 INSTANTIATE_TEST_CASE_P(PmempoolCreateParam, InvalidInheritTests,
-                        ::testing::Values(PoolInherit{
-                            {PoolType::Log},
-                            {PoolType::Obj,
-                             {{Option::Inherit, OptionType::Long,
-                               local_config->GetTestDir() + "pool.file"}},
-                             "error: size must be >= " +
-                                 std::to_string(PMEMOBJ_MIN_POOL) +
-                                 " bytes"}}));
+                        ::testing::ValuesIn(GetInvalidInherits()));
 
 /**
  * InvalidArgumentsPoolsetTests.PMEMPOOL_POOLSET
@@ -191,35 +245,5 @@ TEST_P(InvalidArgumentsPoolsetTests, PMEMPOOL_POOLSET) {
       << "\nActual: " << GetOutputContent();
 }
 
-INSTANTIATE_TEST_CASE_P(
-    PmempoolCreatePoolset, InvalidArgumentsPoolsetTests,
-    ::testing::Values(
-        PoolsetArgs{{PoolType::Obj,
-                     {{Option::Size, OptionType::Long, "30M"}},
-                     "error: -s|--size cannot be used with poolset file"},
-                    Poolset{{"PMEMPOOLSET", "20M"}}},
-        PoolsetArgs{{PoolType::Obj,
-                     {{Option::MaxSize, OptionType::Long}},
-                     "error: -M|--max-size cannot be used with poolset file"},
-                    Poolset{{"PMEMPOOLSET", "20M"}}},
-        PoolsetArgs{{PoolType::Obj,
-                     {{Option::Size, OptionType::Long, "30M"}},
-                     "error: -s|--size cannot be used with poolset file"},
-                    Poolset{{"PMEMPOOLSET", "20M"}}},
-        PoolsetArgs{{PoolType::Obj, "net pool size 7340032 smaller than " +
-                                        std::to_string(PMEMOBJ_MIN_POOL) +
-                                        "\nerror: creating pool file failed"},
-                    Poolset{{"PMEMPOOLSET", "7M"}}},
-        PoolsetArgs{{PoolType::Obj, "net pool size 7340032 smaller than " +
-                                        std::to_string(PMEMOBJ_MIN_POOL) +
-                                        "\nerror: creating pool file failed"},
-                    Poolset{{"PMEMPOOLSET", "20M"}, {"REPLICA", "7M"}}},
-        PoolsetArgs{
-            {PoolType::Log,
-             "replication not supported\nerror: creating pool file failed"},
-            Poolset{{"PMEMPOOLSET", "20M"}, {"REPLICA", "20M"}}},
-        PoolsetArgs{
-            {PoolType::Blk,
-             {{Option::BSize, OptionType::Long, "512"}},
-             " -- replication not supported\nerror: creating pool file failed"},
-            Poolset{{"PMEMPOOLSET", "20M"}, {"REPLICA", "20M"}}}));
+INSTANTIATE_TEST_CASE_P(PmempoolCreatePoolset, InvalidArgumentsPoolsetTests,
+                        ::testing::ValuesIn(GetInvalidPoolsets()));
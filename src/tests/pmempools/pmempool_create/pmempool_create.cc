@@ -43,6 +43,54 @@ int PmempoolCreate::CreatePool(const PoolArgs &pool_args,
   return output_.GetExitCode();
 }
 
+int PmempoolCreate::GetPoolInfo(const std::string &path, PoolInfo &info) {
+  output_ = shell_.ExecuteCommand("pmempool info " + path);
+
+  if (output_.GetExitCode() != 0) {
+    return output_.GetExitCode();
+  }
+
+  return PmempoolOutput::ParseInfo(GetOutputContent(), info);
+}
+
+int PmempoolCreate::CheckPool(const std::string &path, size_t pool_size,
+                              const std::vector<std::string> &files) {
+  RecordProperty("pool_size", std::to_string(pool_size));
+
+  for (CacheState state : CacheMode::GetStates()) {
+    const std::string prefix = CacheMode::GetName(state) + "_";
+    long long check_time_us = 0;
+
+    if (CacheMode::Prepare(state, files.empty()
+                                      ? std::vector<std::string>{path}
+                                      : files) != 0 ||
+        file_utils::CheckConsistency(path, check_time_us) != 0) {
+      return -1;
+    }
+
+    RecordProperty(prefix + "check_time_us", std::to_string(check_time_us));
+
+    if (check_time_us > 0) {
+      RecordProperty(prefix + "check_throughput_MiBps",
+                     std::to_string(static_cast<double>(pool_size) /
+                                    MEBIBYTE * 1000000 / check_time_us));
+    }
+  }
+
+  return 0;
+}
+
+int PmempoolCreate::CheckPool(const Poolset &poolset) {
+  std::vector<std::string> files{poolset.GetFullPath()};
+
+  for (const auto &part : poolset.GetParts()) {
+    files.emplace_back(part.GetPath());
+  }
+
+  return CheckPool(poolset.GetFullPath(), file_utils::GetPoolsetSize(poolset),
+                   files);
+}
+
 void PmempoolCreate::TearDown() {
   api_c_.CleanDirectory(local_config->GetTestDir());
 }
@@ -33,9 +33,11 @@
 #ifndef PMDK_TESTS_SRC_TESTS_PMEMPOOLS_PMEMPOOL_CREATE_PMEMPOOL_CREATE_H_
 #define PMDK_TESTS_SRC_TESTS_PMEMPOOLS_PMEMPOOL_CREATE_PMEMPOOL_CREATE_H_
 
+#include "cache_mode/cache_mode.h"
 #include "configXML/local_configuration.h"
 #include "gtest/gtest.h"
 #include "output/output.h"
+#include "pmempool_output/pmempool_output.h"
 #include "shell/i_shell.h"
 #include "structures.h"
 #include "test_utils/file_utils.h"
@@ -60,6 +62,10 @@ class PmempoolCreate : public ::testing::Test {
   }
 
   int CreatePool(const PoolArgs &pool_args, const std::string &path);
+  int CheckPool(const std::string &path, size_t pool_size,
+                const std::vector<std::string> &files = {});
+  int CheckPool(const Poolset &poolset);
+  int GetPoolInfo(const std::string &path, PoolInfo &info);
 
   virtual void TearDown();
 };
@@ -31,6 +31,16 @@
  */
 
 #include "pmempool_create.h"
+#include "test_runner/footprint.h"
+
+namespace {
+/* pool takes whole free space of test directory */
+const Footprint max_size_footprint{"PmempoolCreate.PMEMPOOL_CREATE_MAX_SIZE",
+                                   Footprint::EXCLUSIVE};
+
+/* largest pool created by remaining tests */
+const Footprint create_footprint{"PmempoolCreate", 20 * MEBIBYTE};
+}  // namespace
 
 /**
  * PMEMPOOL_CREATE_INHERIT
@@ -65,6 +75,7 @@ TEST_F(PmempoolCreate, PMEMPOOL_CREATE_INVALID_INHERIT) {
  * \test
  *          \li \c Step1. Create log pool with maximal size / SUCCESS
  *          \li \c Step2. Check the size of the created pool
+ *          \li \c Step3. Make sure that whole pool is allocated
  */
 TEST_F(PmempoolCreate, PMEMPOOL_CREATE_MAX_SIZE) {
   size_t free_space = api_c_.GetFreeSpaceT(local_config->GetTestDir());
@@ -75,6 +86,8 @@ TEST_F(PmempoolCreate, PMEMPOOL_CREATE_MAX_SIZE) {
       << GetOutputContent();
   /* Step 2 */
   EXPECT_EQ(free_space, api_c_.GetFileSize(pool_path_));
+  /* Step 3 */
+  EXPECT_EQ(0, file_utils::ValidateAllocation(pool_path_, free_space));
 }
 
 /**
@@ -82,14 +95,11 @@ TEST_F(PmempoolCreate, PMEMPOOL_CREATE_MAX_SIZE) {
  * Creating obj pool with verbose option enabled
  * \test
  *          \li \c Step1. Create obj pool with verbose option / SUCCESS
- *          \li \c Step2. Make sure that expected output is returned
+ *          \li \c Step2. Parse verbose output / SUCCESS
+ *          \li \c Step3. Make sure that output describes created pool
  */
 TEST_F(PmempoolCreate, PMEMPOOL_CREATE_VERBOSE) {
-  const std::string out_msg = "Creating pool: " + pool_path_ +
-                              "\n\ttype  : obj"
-                              "\n\tsize  : 20.0M [20971520]"
-                              "\n\tmode  : 0664"
-                              "\n\tlayout: ''";
+  CreateInfo info;
   /* Step 1 */
   EXPECT_EQ(0, CreatePool(PoolArgs{PoolType::Obj,
                                    {{Option::Verbose, OptionType::Long},
@@ -97,8 +107,45 @@ TEST_F(PmempoolCreate, PMEMPOOL_CREATE_VERBOSE) {
                           pool_path_))
       << GetOutputContent();
   /* Step 2 */
-  EXPECT_TRUE(string_utils::IsSubstrFound(out_msg, GetOutputContent()))
-      << "Expected: " << out_msg << "\nActual: " << GetOutputContent();
+  ASSERT_EQ(0, PmempoolOutput::ParseCreate(GetOutputContent(), info))
+      << GetOutputContent();
+  /* Step 3 */
+  EXPECT_EQ(pool_path_, info.path);
+  EXPECT_EQ("obj", info.type);
+  EXPECT_EQ(20 * MEBIBYTE, info.size);
+  EXPECT_EQ(0664u, info.mode);
+  EXPECT_EQ("", info.layout);
+}
+
+/**
+ * PMEMPOOL_CREATE_INFO
+ * Inspecting created obj pool with pmempool info
+ * \test
+ *          \li \c Step1. Create obj pool with layout name / SUCCESS
+ *          \li \c Step2. Display information about pool with pmempool info
+ * and parse it / SUCCESS
+ *          \li \c Step3. Make sure that pool header and obj header describe
+ * created pool
+ */
+TEST_F(PmempoolCreate, PMEMPOOL_CREATE_INFO) {
+  PoolInfo info;
+  /* Step 1 */
+  EXPECT_EQ(0, CreatePool(PoolArgs{PoolType::Obj,
+                                   {{Option::Layout, OptionType::Long,
+                                     "test_layout"},
+                                    {Option::Size, OptionType::Long, "20M"}}},
+                          pool_path_))
+      << GetOutputContent();
+  /* Step 2 */
+  ASSERT_EQ(0, GetPoolInfo(pool_path_, info)) << GetOutputContent();
+  /* Step 3 */
+  EXPECT_EQ(pool_path_, info.path);
+  EXPECT_EQ(20 * MEBIBYTE, info.size);
+  EXPECT_EQ("PMEMOBJ", info.signature);
+  EXPECT_TRUE(info.checksum_ok);
+  EXPECT_EQ("test_layout", info.layout);
+  EXPECT_LT(0u, info.lanes_count);
+  EXPECT_LT(info.heap_offset, info.size);
 }
 
 /**
@@ -109,26 +156,27 @@ TEST_F(PmempoolCreate, PMEMPOOL_CREATE_VERBOSE) {
  * long option / SUCCESS
  *          \li \c Step2. Display help message for pmempool create command using
  * short option / SUCCESS
- *          \li \c Step3. Make sure that expected output is returned
+ *          \li \c Step3. Make sure that output contains each expected line
+ * of help message
  */
 TEST_F(PmempoolCreate, PMEMPOOL_CREATE_HELP_MESSAGES) {
-  const std::string expected_help_msg =
-      "Create pmem pool of specified size, type and name\n\n"
-      "Common options:\n"
-      "  -s, --size  <size>   size of pool\n"
-      "  -M, --max-size       use maximum available space on file system\n"
-      "  -m, --mode <octal>   set permissions to <octal> (the default is "
-      "0664)\n"
-      "  -i, --inherit <file> take required parameters from specified pool "
-      "file\n"
-      "  -f, --force          remove the pool first\n"
-      "  -v, --verbose        increase verbosity level\n"
-      "  -h, --help           display this help and exit\n\n"
-      "Options for PMEMBLK:\n"
-      "  -w, --write-layout force writing the BTT layout\n\n"
-      "Options for PMEMOBJ and PMEMCTO:\n"
-      "  -l, --layout <name>  layout name stored in pool's header\n\n"
-      "For complete documentation see pmempool-create(1) manual page.\n";
+  const string_utils::MultiMatcher<char> expected_help_msg{
+      {"Create pmem pool of specified size, type and name\n",
+       "Common options:\n",
+       "  -s, --size  <size>   size of pool\n",
+       "  -M, --max-size       use maximum available space on file system\n",
+       "  -m, --mode <octal>   set permissions to <octal> (the default is "
+       "0664)\n",
+       "  -i, --inherit <file> take required parameters from specified pool "
+       "file\n",
+       "  -f, --force          remove the pool first\n",
+       "  -v, --verbose        increase verbosity level\n",
+       "  -h, --help           display this help and exit\n",
+       "Options for PMEMBLK:\n",
+       "  -w, --write-layout force writing the BTT layout\n",
+       "Options for PMEMOBJ and PMEMCTO:\n",
+       "  -l, --layout <name>  layout name stored in pool's header\n",
+       "For complete documentation see pmempool-create(1) manual page.\n"}};
   /* Step 1 */
   EXPECT_EQ(0, shell_.ExecuteCommand("pmempool create -h").GetExitCode());
   std::string output1 = shell_.GetLastOutput().GetContent();
@@ -136,6 +184,6 @@ TEST_F(PmempoolCreate, PMEMPOOL_CREATE_HELP_MESSAGES) {
   EXPECT_EQ(0, shell_.ExecuteCommand("pmempool create --help").GetExitCode());
   std::string output2 = shell_.GetLastOutput().GetContent();
   /* Step 3 */
-  EXPECT_TRUE(string_utils::IsSubstrFound(expected_help_msg, output1));
-  EXPECT_TRUE(string_utils::IsSubstrFound(expected_help_msg, output2));
+  EXPECT_TRUE(expected_help_msg.MatchAll(output1)) << output1;
+  EXPECT_TRUE(expected_help_msg.MatchAll(output2)) << output2;
 }
@@ -52,3 +52,21 @@ void ValidPoolsetTests::SetUp() {
 
   ASSERT_EQ(0, p_mgmt_.CreatePoolsetFile(poolset_args.poolset));
 }
+
+Poolset ExistingPartsTests::GetPoolset() {
+  return Poolset{{"PMEMPOOLSET", "8M", "8M", "8M", "8M"},
+                 {"REPLICA", "8M", "8M", "8M", "8M"},
+                 {"REPLICA", "8M", "8M", "8M", "8M"}};
+}
+
+void ExistingPartsTests::SetUp() {
+  CreatePartsReport report;
+
+  ASSERT_EQ(0, p_mgmt_.CreatePoolsetFile(poolset));
+  ASSERT_EQ(0, p_mgmt_.CreateParts(poolset, GetParam(), report));
+
+  RecordProperty("parts", std::to_string(report.parts.size()));
+  RecordProperty("devices", std::to_string(report.devices));
+  RecordProperty("create_parts_us", std::to_string(report.total.count()));
+  RecordProperty("slowest_part_us", std::to_string(report.slowest.count()));
+}
@@ -59,4 +59,14 @@ class ValidPoolsetTests : public PmempoolCreate,
   void SetUp() override;
 };
 
+class ExistingPartsTests : public PmempoolCreate,
+                           public ::testing::WithParamInterface<PartPolicy> {
+ public:
+  Poolset poolset = GetPoolset();
+
+  static Poolset GetPoolset();
+
+  void SetUp() override;
+};
+
 #endif  // !PMDK_TESTS_SRC_TESTS_PMEMPOOLS_PMEMPOOL_CREATE_PMEMPOOL_CREATE_VALID_ARGUMENTS_H_
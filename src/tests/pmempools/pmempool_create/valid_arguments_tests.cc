@@ -31,6 +31,98 @@
  */
 
 #include "valid_arguments.h"
+#include "pool_args_space.h"
+#include "test_runner/footprint.h"
+
+namespace {
+std::vector<PoolArgs> GetValidArgs() {
+  return {PoolArgs{PoolType::Blk,
+                   {{Option::BSize, OptionType::Short, "512"},
+                    {Option::Size, OptionType::Long, "20M"},
+                    {Option::Mode, OptionType::Short, "777"}}},
+          PoolArgs{PoolType::Blk,
+                   {{Option::BSize, OptionType::Short, "8"},
+                    {Option::Mode, OptionType::Short, "444"}}},
+          PoolArgs{PoolType::Log}, PoolArgs{PoolType::Obj}};
+}
+
+std::vector<PoolInherit> GetValidInherits() {
+  return {PoolInherit{
+              {PoolType::Blk, {{Option::BSize, OptionType::Short, "512"}}},
+              {PoolType::Obj,
+               {{Option::Inherit, OptionType::Long,
+                 local_config->GetTestDir() + "pool.file"}}}},
+          PoolInherit{{PoolType::Obj},
+                      {PoolType::Log,
+                       {{Option::Inherit, OptionType::Long,
+                         local_config->GetTestDir() + "pool.file"}}}}};
+}
+
+std::vector<PoolsetArgs> GetValidPoolsets() {
+  return {
+      PoolsetArgs{{PoolType::Blk, {{Option::BSize, OptionType::Short, "8"}}},
+                  Poolset{{"PMEMPOOLSET", "20M"}}},
+      PoolsetArgs{{PoolType::Obj}, Poolset{{"PMEMPOOLSET", "20M"}}},
+      PoolsetArgs{{PoolType::Log}, Poolset{{"PMEMPOOLSET", "20M"}}},
+      PoolsetArgs{{PoolType::Obj},
+                  Poolset{{"PMEMPOOLSET", "20M"}, {"REPLICA", "20M"}}}};
+}
+
+/* all pairs of blk pool options */
+const PoolArgsGenerator blk_pairwise{
+    PoolArgsSpace{
+        {PoolType::Blk},
+        {{Option::BSize, {OptionType::Short}, {"512", "8"}, false},
+         {Option::Size, {OptionType::Long, OptionType::Short}, {"20M", "64M"}},
+         {Option::Mode,
+          {OptionType::Short, OptionType::Long},
+          {"777", "444", "600"}},
+         {Option::WriteLayout, {OptionType::Short, OptionType::Long}}}},
+    Coverage::Pairwise};
+
+/* all combinations of size and mode options of obj and log pools */
+const PoolArgsGenerator obj_log_full{
+    PoolArgsSpace{{PoolType::Obj, PoolType::Log},
+                  {{Option::Size,
+                    {OptionType::Long, OptionType::ShortNoSpace},
+                    {"20M"}},
+                   {Option::Mode,
+                    {OptionType::Short, OptionType::ShortNoSpace},
+                    {"600"}}}},
+    Coverage::Full};
+
+const Footprint valid_footprint{
+    "PmempoolCreateParam/ValidTests", [](size_t index) {
+      return struct_utils::GetPoolSize(GetValidArgs().at(index));
+    }};
+
+const Footprint blk_pairwise_footprint{
+    "PmempoolCreateBlkPairwise/ValidTests", [](size_t index) {
+      return struct_utils::GetPoolSize(blk_pairwise.Get(index));
+    }};
+
+const Footprint obj_log_full_footprint{
+    "PmempoolCreateObjLogFull/ValidTests", [](size_t index) {
+      return struct_utils::GetPoolSize(obj_log_full.Get(index));
+    }};
+
+/* base pool and the pool inheriting its settings */
+const Footprint valid_inherit_footprint{
+    "PmempoolCreateParam/ValidInheritTests", [](size_t index) {
+      return 2 * struct_utils::GetPoolSize(
+                     GetValidInherits().at(index).pool_base);
+    }};
+
+const Footprint valid_poolset_footprint{
+    "PmempoolCreatePoolset/ValidPoolsetTests", [](size_t index) {
+      return file_utils::GetPartsSize(GetValidPoolsets().at(index).poolset);
+    }};
+
+const Footprint existing_parts_footprint{
+    "PmempoolCreatePoolset/ExistingPartsTests", [](size_t) {
+      return file_utils::GetPartsSize(ExistingPartsTests::GetPoolset());
+    }};
+}  // namespace
 
 /**
  * PmempoolCreateValidTests.PMEMPOOL_CREATE
@@ -40,10 +132,13 @@
  * - bsize and mode options specified for blk pool
  * - log pool
  * - obj pool
+ * - pairwise combinations of blk pool options
+ * - all combinations of size and mode options of obj and log pools
  * \test
  *          \li \c Step1. Create pool with specified arguments / SUCCESS
  *          \li \c Step2. Make sure that pool exists and validate it's size and
  * mode
+ *          \li \c Step3. Make sure that pool is consistent
  */
 TEST_P(ValidTests, PMEMPOOL_CREATE) {
   /* Step 1 */
@@ -52,18 +147,18 @@ TEST_P(ValidTests, PMEMPOOL_CREATE) {
   EXPECT_EQ(0, file_utils::ValidateFile(pool_path_,
                                         struct_utils::GetPoolSize(pool_args),
                                         struct_utils::GetPoolMode(pool_args)));
+  /* Step 3 */
+  EXPECT_EQ(0, CheckPool(pool_path_, struct_utils::GetPoolSize(pool_args)));
 }
 
-INSTANTIATE_TEST_CASE_P(
-    PmempoolCreateParam, ValidTests,
-    ::testing::Values(PoolArgs{PoolType::Blk,
-                               {{Option::BSize, OptionType::Short, "512"},
-                                {Option::Size, OptionType::Long, "20M"},
-                                {Option::Mode, OptionType::Short, "777"}}},
-                      PoolArgs{PoolType::Blk,
-                               {{Option::BSize, OptionType::Short, "8"},
-                                {Option::Mode, OptionType::Short, "444"}}},
-                      PoolArgs{PoolType::Log}, PoolArgs{PoolType::Obj}));
+INSTANTIATE_TEST_CASE_P(PmempoolCreateParam, ValidTests,
+                        ::testing::ValuesIn(GetValidArgs()));
+
+INSTANTIATE_TEST_CASE_P(PmempoolCreateBlkPairwise, ValidTests,
+                        blk_pairwise.GetValues());
+
+INSTANTIATE_TEST_CASE_P(PmempoolCreateObjLogFull, ValidTests,
+                        obj_log_full.GetValues());
 
 /**
  * PmempoolCreateValidInheritTests.PMEMPOOL_INHERIT_PROPERTIES
@@ -75,6 +170,7 @@ INSTANTIATE_TEST_CASE_P(
  * pool / SUCCESS
  *          \li \c Step2. Make sure that pool exists and validate it's size and
  * mode
+ *          \li \c Step3. Make sure that pool is consistent
  */
 TEST_P(ValidInheritTests, PMEMPOOL_INHERIT_PROPERTIES) {
   /* Step 1 */
@@ -85,20 +181,13 @@ TEST_P(ValidInheritTests, PMEMPOOL_INHERIT_PROPERTIES) {
                    inherit_file_path_,
                    struct_utils::GetPoolSize(pool_inherit.pool_base),
                    struct_utils::GetPoolMode(pool_inherit.pool_inherited)));
+  /* Step 3 */
+  EXPECT_EQ(0, CheckPool(inherit_file_path_,
+                         struct_utils::GetPoolSize(pool_inherit.pool_base)));
 }
 
-INSTANTIATE_TEST_CASE_P(
-    PmempoolCreateParam, ValidInheritTests,
-    ::testing::Values(
-        PoolInherit{
-            {PoolType::Blk, {{Option::BSize, OptionType::Short, "512"}}},
-            {PoolType::Obj,
-             {{Option::Inherit, OptionType::Long,
-               local_config->GetTestDir() + "pool.file"}}}},
-        PoolInherit{{PoolType::Obj},
-                    {PoolType::Log,
-                     {{Option::Inherit, OptionType::Long,
-                       local_config->GetTestDir() + "pool.file"}}}}));
+INSTANTIATE_TEST_CASE_P(PmempoolCreateParam, ValidInheritTests,
+                        ::testing::ValuesIn(GetValidInherits()));
 
 /**
  * PmempoolCreateValidPoolsetTests.PMEMPOOL_POOLSET
@@ -107,6 +196,8 @@ INSTANTIATE_TEST_CASE_P(
  *          \li \c Step1: Create pool described by poolset file / SUCCESS
  *          \li \c Step2: Make sure that pool described by poolset exists and
  * validate it's size and mode
+ *          \li \c Step3: Make sure that pool described by poolset is
+ * consistent
  */
 TEST_P(ValidPoolsetTests, PMEMPOOL_POOLSET) {
   /* Step 1 */
@@ -117,14 +208,34 @@ TEST_P(ValidPoolsetTests, PMEMPOOL_POOLSET) {
   EXPECT_EQ(0, file_utils::ValidatePoolset(
                    poolset_args.poolset,
                    struct_utils::GetPoolMode(poolset_args.args)));
+  /* Step 3 */
+  EXPECT_EQ(0, CheckPool(poolset_args.poolset));
+}
+
+INSTANTIATE_TEST_CASE_P(PmempoolCreatePoolset, ValidPoolsetTests,
+                        ::testing::ValuesIn(GetValidPoolsets()));
+
+/**
+ * PmempoolCreateExistingPartsTests.PMEMPOOL_POOLSET_EXISTING_PARTS
+ * Creating pool described by poolset file which parts already exist, created
+ * in parallel as:
+ * - sparse files
+ * - allocated files
+ * - zeroed files
+ * \test
+ *          \li \c Step1: Create pool described by poolset file / SUCCESS
+ *          \li \c Step2: Make sure that pool described by poolset is
+ * consistent
+ */
+TEST_P(ExistingPartsTests, PMEMPOOL_POOLSET_EXISTING_PARTS) {
+  /* Step 1 */
+  EXPECT_EQ(0, CreatePool(PoolArgs{PoolType::Obj}, poolset.GetFullPath()))
+      << GetOutputContent();
+  /* Step 2 */
+  EXPECT_EQ(0, CheckPool(poolset));
 }
 
-INSTANTIATE_TEST_CASE_P(
-    PmempoolCreatePoolset, ValidPoolsetTests,
-    ::testing::Values(
-        PoolsetArgs{{PoolType::Blk, {{Option::BSize, OptionType::Short, "8"}}},
-                    Poolset{{"PMEMPOOLSET", "20M"}}},
-        PoolsetArgs{{PoolType::Obj}, Poolset{{"PMEMPOOLSET", "20M"}}},
-        PoolsetArgs{{PoolType::Log}, Poolset{{"PMEMPOOLSET", "20M"}}},
-        PoolsetArgs{{PoolType::Obj},
-                    Poolset{{"PMEMPOOLSET", "20M"}, {"REPLICA", "20M"}}}));
+INSTANTIATE_TEST_CASE_P(PmempoolCreatePoolset, ExistingPartsTests,
+                        ::testing::Values(PartPolicy::Sparse,
+                                          PartPolicy::Allocate,
+                                          PartPolicy::Zero));
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pmempool_sync.h"
+
+void PrintTo(Damage damage, std::ostream *os) {
+  *os << (damage == Damage::RemovePart ? "removed part" : "zeroed part");
+}
+
+int PmempoolSync::CreatePool() {
+  if (p_mgmt_.CreatePoolsetFile(poolset_) != 0) {
+    return -1;
+  }
+
+  return pool_data::CreateObjPool(poolset_.GetFullPath(), data_size_);
+}
+
+int PmempoolSync::DamageReplica(Damage damage, unsigned replica) {
+  const Part &part = poolset_.GetReplica(replica).GetPart(0);
+
+  return damage == Damage::RemovePart ? p_mgmt_.RemovePart(part)
+                                      : p_mgmt_.ZeroPart(part);
+}
+
+int PmempoolSync::SyncPool(Interface interface, bool dry_run) {
+  if (interface == Interface::CLI) {
+    output_ = shell_.ExecuteCommand(std::string("pmempool sync ") +
+                                    (dry_run ? "--dry-run " : "") +
+                                    poolset_.GetFullPath());
+  } else {
+    int ret = pmempool_sync(poolset_.GetFullPath().c_str(),
+                            dry_run ? PMEMPOOL_SYNC_DRY_RUN : 0);
+    output_ = Output<>(ret, ret == 0 ? "" : pmempool_errormsg());
+  }
+
+  return output_.GetExitCode();
+}
+
+void PmempoolSync::TearDown() {
+  ApiC::CleanDirectory(local_config->GetTestDir());
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pmempool_sync.h"
+#include "test_runner/footprint.h"
+
+namespace {
+/* two parts of master replica and two parts of replica */
+const Footprint sync_footprint{"PmempoolSync", 4 * 16 * MEBIBYTE};
+}  // namespace
+
+/**
+ * PmempoolSyncDamaged.PMEMPOOL_SYNC_DAMAGED_REPLICA
+ * Healing damaged replica of obj pool with pmempool sync:
+ * - replica with removed part
+ * - replica with zeroed part
+ * using command line tool and libpmempool API
+ * \test
+ *          \li \c Step1. Create obj pool with replica and fill it with
+ * data / SUCCESS
+ *          \li \c Step2. Damage first part of the replica / SUCCESS
+ *          \li \c Step3. Synchronize replicas / SUCCESS
+ *          \li \c Step4. Make sure that all parts exist and pool is
+ * consistent
+ *          \li \c Step5. Make sure that content of healed replica matches
+ * master replica
+ *          \li \c Step6. Make sure that data in pool is intact
+ */
+TEST_P(PmempoolSyncDamaged, PMEMPOOL_SYNC_DAMAGED_REPLICA) {
+  Interface interface;
+  Damage damage;
+  std::tie(interface, damage) = GetParam();
+
+  /* Step 1 */
+  ASSERT_EQ(0, CreatePool());
+  /* Step 2 */
+  ASSERT_EQ(0, DamageReplica(damage, 1));
+  /* Step 3 */
+  EXPECT_EQ(0, SyncPool(interface)) << GetOutputContent();
+  /* Step 4 */
+  EXPECT_TRUE(p_mgmt_.AllFilesExist(poolset_));
+  long long check_time_us = 0;
+  EXPECT_EQ(0, file_utils::CheckConsistency(poolset_.GetFullPath(),
+                                            check_time_us));
+  /* Step 5 */
+  long long mismatch_offset = 0;
+  EXPECT_EQ(0, file_utils::CompareReplicas(poolset_, 1, mismatch_offset));
+  EXPECT_EQ(-1, mismatch_offset);
+  /* Step 6 */
+  EXPECT_EQ(0, pool_data::VerifyObjPool(poolset_.GetFullPath(), data_size_));
+}
+
+INSTANTIATE_TEST_CASE_P(
+    PmempoolSync, PmempoolSyncDamaged,
+    ::testing::Combine(::testing::Values(Interface::CLI, Interface::API),
+                       ::testing::Values(Damage::RemovePart,
+                                         Damage::ZeroPart)));
+
+/**
+ * PmempoolSyncInterface.PMEMPOOL_SYNC_DRY_RUN_MODE
+ * Synchronizing replicas in dry run mode using command line tool and
+ * libpmempool API
+ * \test
+ *          \li \c Step1. Create obj pool with replica / SUCCESS
+ *          \li \c Step2. Remove first part of the replica / SUCCESS
+ *          \li \c Step3. Synchronize replicas in dry run mode / SUCCESS
+ *          \li \c Step4. Make sure that removed part was not recreated
+ */
+TEST_P(PmempoolSyncInterface, PMEMPOOL_SYNC_DRY_RUN_MODE) {
+  /* Step 1 */
+  ASSERT_EQ(0, CreatePool());
+  /* Step 2 */
+  ASSERT_EQ(0, DamageReplica(Damage::RemovePart, 1));
+  /* Step 3 */
+  EXPECT_EQ(0, SyncPool(GetParam(), true)) << GetOutputContent();
+  /* Step 4 */
+  EXPECT_FALSE(p_mgmt_.PartExists(poolset_.GetReplica(1).GetPart(0)));
+}
+
+INSTANTIATE_TEST_CASE_P(PmempoolSync, PmempoolSyncInterface,
+                        ::testing::Values(Interface::CLI, Interface::API));
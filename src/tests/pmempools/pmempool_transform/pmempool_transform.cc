@@ -0,0 +1,63 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pmempool_transform.h"
+
+void PmempoolTransform::SetUp() {
+  ASSERT_EQ(0, p_mgmt_.CreatePoolsetFile(without_replica_));
+  ASSERT_EQ(0, p_mgmt_.CreatePoolsetFile(with_replica_));
+}
+
+int PmempoolTransform::CreatePool(const Poolset &poolset) {
+  return pool_data::CreateObjPool(poolset.GetFullPath(), data_size_);
+}
+
+int PmempoolTransform::TransformPool(const Poolset &in, const Poolset &out,
+                                     bool dry_run) {
+  if (GetParam() == Interface::CLI) {
+    output_ = shell_.ExecuteCommand(std::string("pmempool transform ") +
+                                    (dry_run ? "--dry-run " : "") +
+                                    in.GetFullPath() + " " +
+                                    out.GetFullPath());
+  } else {
+    int ret = pmempool_transform(in.GetFullPath().c_str(),
+                                 out.GetFullPath().c_str(),
+                                 dry_run ? PMEMPOOL_TRANSFORM_DRY_RUN : 0);
+    output_ = Output<>(ret, ret == 0 ? "" : pmempool_errormsg());
+  }
+
+  return output_.GetExitCode();
+}
+
+void PmempoolTransform::TearDown() {
+  ApiC::CleanDirectory(local_config->GetTestDir());
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_PMEMPOOLS_PMEMPOOL_TRANSFORM_PMEMPOOL_TRANSFORM_H_
+#define PMDK_TESTS_SRC_TESTS_PMEMPOOLS_PMEMPOOL_TRANSFORM_PMEMPOOL_TRANSFORM_H_
+
+#include "configXML/local_configuration.h"
+#include "gtest/gtest.h"
+#include "output/output.h"
+#include "pool_data.h"
+#include "shell/i_shell.h"
+#include "structures.h"
+#include "test_utils/file_utils.h"
+
+extern std::unique_ptr<LocalConfiguration> local_config;
+
+class PmempoolTransform : public ::testing::TestWithParam<Interface> {
+ private:
+  Output<> output_;
+
+ public:
+  IShell shell_;
+  PoolsetManagement p_mgmt_;
+  const size_t data_size_ = MEBIBYTE;
+  const Poolset without_replica_{local_config->GetTestDir(),
+                                 "pool.set",
+                                 {{"PMEMPOOLSET", "16M", "16M"}}};
+  const Poolset with_replica_{local_config->GetTestDir(),
+                              "pool_replica.set",
+                              {{"PMEMPOOLSET", "16M", "16M"},
+                               {"REPLICA", "16M", "16M"}}};
+
+  const std::string &GetOutputContent() const {
+    return output_.GetContent();
+  }
+
+  int CreatePool(const Poolset &poolset);
+  int TransformPool(const Poolset &in, const Poolset &out,
+                    bool dry_run = false);
+
+  void SetUp() override;
+  void TearDown() override;
+};
+
+#endif  // !PMDK_TESTS_SRC_TESTS_PMEMPOOLS_PMEMPOOL_TRANSFORM_PMEMPOOL_TRANSFORM_H_
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pmempool_transform.h"
+#include "test_runner/footprint.h"
+
+namespace {
+/* two parts of master replica and two parts of replica */
+const Footprint transform_footprint{"PmempoolTransform", 4 * 16 * MEBIBYTE};
+}  // namespace
+
+/**
+ * PmempoolTransform.PMEMPOOL_TRANSFORM_ADD_REPLICA
+ * Adding replica to obj pool with pmempool transform using command line tool
+ * and libpmempool API
+ * \test
+ *          \li \c Step1. Create obj pool without replica and fill it with
+ * data / SUCCESS
+ *          \li \c Step2. Transform pool to poolset with replica / SUCCESS
+ *          \li \c Step3. Make sure that replica parts exist and pool is
+ * consistent
+ *          \li \c Step4. Make sure that data in pool is intact
+ */
+TEST_P(PmempoolTransform, PMEMPOOL_TRANSFORM_ADD_REPLICA) {
+  /* Step 1 */
+  ASSERT_EQ(0, CreatePool(without_replica_));
+  /* Step 2 */
+  EXPECT_EQ(0, TransformPool(without_replica_, with_replica_))
+      << GetOutputContent();
+  /* Step 3 */
+  EXPECT_TRUE(p_mgmt_.ReplicaExists(with_replica_.GetReplica(1)));
+  long long check_time_us = 0;
+  EXPECT_EQ(0, file_utils::CheckConsistency(with_replica_.GetFullPath(),
+                                            check_time_us));
+  /* Step 4 */
+  EXPECT_EQ(0,
+            pool_data::VerifyObjPool(with_replica_.GetFullPath(), data_size_));
+}
+
+/**
+ * PmempoolTransform.PMEMPOOL_TRANSFORM_REMOVE_REPLICA
+ * Removing replica from obj pool with pmempool transform using command line
+ * tool and libpmempool API
+ * \test
+ *          \li \c Step1. Create obj pool with replica and fill it with
+ * data / SUCCESS
+ *          \li \c Step2. Transform pool to poolset without replica / SUCCESS
+ *          \li \c Step3. Make sure that pool is consistent
+ *          \li \c Step4. Make sure that data in pool is intact
+ */
+TEST_P(PmempoolTransform, PMEMPOOL_TRANSFORM_REMOVE_REPLICA) {
+  /* Step 1 */
+  ASSERT_EQ(0, CreatePool(with_replica_));
+  /* Step 2 */
+  EXPECT_EQ(0, TransformPool(with_replica_, without_replica_))
+      << GetOutputContent();
+  /* Step 3 */
+  long long check_time_us = 0;
+  EXPECT_EQ(0, file_utils::CheckConsistency(without_replica_.GetFullPath(),
+                                            check_time_us));
+  /* Step 4 */
+  EXPECT_EQ(0, pool_data::VerifyObjPool(without_replica_.GetFullPath(),
+                                        data_size_));
+}
+
+/**
+ * PmempoolTransform.PMEMPOOL_TRANSFORM_DRY_RUN_MODE
+ * Adding replica to obj pool in dry run mode using command line tool and
+ * libpmempool API
+ * \test
+ *          \li \c Step1. Create obj pool without replica / SUCCESS
+ *          \li \c Step2. Transform pool to poolset with replica in dry run
+ * mode / SUCCESS
+ *          \li \c Step3. Make sure that replica parts were not created
+ */
+TEST_P(PmempoolTransform, PMEMPOOL_TRANSFORM_DRY_RUN_MODE) {
+  /* Step 1 */
+  ASSERT_EQ(0, CreatePool(without_replica_));
+  /* Step 2 */
+  EXPECT_EQ(0, TransformPool(without_replica_, with_replica_, true))
+      << GetOutputContent();
+  /* Step 3 */
+  EXPECT_FALSE(p_mgmt_.PartExists(with_replica_.GetReplica(1).GetPart(0)));
+}
+
+INSTANTIATE_TEST_CASE_P(PmempoolTransform, PmempoolTransform,
+                        ::testing::Values(Interface::CLI, Interface::API));
@@ -0,0 +1,363 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_PMEMPOOLS_UTILS_POOL_ARGS_SPACE_H_
+#define PMDK_TESTS_SRC_TESTS_PMEMPOOLS_UTILS_POOL_ARGS_SPACE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "gtest/gtest.h"
+#include "structures.h"
+
+/*
+ * OptionSpace -- values which option takes in generated parameters. Each
+ * value is combined with each argument type, option without value (e.g.
+ * --force) has single empty value. Optional option is also left out.
+ */
+struct OptionSpace {
+  Option option;
+  std::vector<OptionType> arg_types;
+  std::vector<std::string> values;
+  bool optional;
+
+  OptionSpace(Option option, std::vector<OptionType> arg_types,
+              std::vector<std::string> values = {""}, bool optional = true)
+      : option(option),
+        arg_types(arg_types),
+        values(values),
+        optional(optional) {
+  }
+
+  size_t GetCount() const {
+    return arg_types.size() * values.size() + (optional ? 1 : 0);
+  }
+};
+
+/*
+ * PoolArgsSpace -- declarative description of PoolArgs parameters: pool
+ * types combined with values of each option. Combination is identified by
+ * index of chosen value in each dimension and expanded into PoolArgs only
+ * when requested.
+ */
+class PoolArgsSpace final {
+ private:
+  std::vector<PoolType> pool_types_;
+  std::vector<OptionSpace> options_;
+
+ public:
+  PoolArgsSpace(std::vector<PoolType> pool_types,
+                std::vector<OptionSpace> options)
+      : pool_types_(pool_types), options_(options) {
+  }
+
+  std::vector<size_t> GetDimensions() const {
+    std::vector<size_t> dimensions{pool_types_.size()};
+
+    for (const auto &option : options_) {
+      dimensions.push_back(option.GetCount());
+    }
+
+    return dimensions;
+  }
+
+  PoolArgs Expand(const std::vector<size_t> &choice) const {
+    PoolArgs pool_args{pool_types_.at(choice.at(0))};
+
+    for (size_t i = 0; i < options_.size(); ++i) {
+      const OptionSpace &option = options_[i];
+      size_t value = choice.at(i + 1);
+
+      if (value == option.arg_types.size() * option.values.size()) {
+        continue;
+      }
+
+      pool_args.args.emplace_back(
+          option.option, option.arg_types.at(value / option.values.size()),
+          option.values.at(value % option.values.size()));
+    }
+
+    return pool_args;
+  }
+};
+
+enum class Coverage { Full, Pairwise };
+
+namespace pool_args_space {
+/* value of dimension not needed for coverage yet */
+const size_t DONT_CARE = std::numeric_limits<size_t>::max();
+}  // namespace pool_args_space
+
+/*
+ * PoolArgsGenerator -- sequence of PoolArgs combinations from given space,
+ * either all of them or set covering each pair of values of any two
+ * dimensions at least once. With sample set, only that many combinations
+ * spread evenly over the sequence from seed-dependent offset are taken. Each
+ * PoolArgs is expanded only when accessed, so that whole matrix is never
+ * held in memory.
+ */
+class PoolArgsGenerator final {
+ private:
+  PoolArgsSpace space_;
+  std::vector<size_t> dimensions_;
+  Coverage coverage_;
+  std::vector<std::vector<size_t>> rows_;
+  size_t count_ = 1;
+  size_t size_;
+  size_t stride_ = 1;
+  size_t offset_ = 0;
+
+  /*
+   * CoverPairs -- builds pairwise covering rows dimension by dimension
+   * (in-parameter-order strategy): existing rows are extended with value
+   * covering the most uncovered pairs, then rows are added or their
+   * unassigned values set for pairs which are still uncovered.
+   */
+  void CoverPairs() {
+    using pool_args_space::DONT_CARE;
+    const std::vector<size_t> &dims = dimensions_;
+
+    for (size_t a = 0; a < dims[0]; ++a) {
+      for (size_t b = 0; b < (dims.size() > 1 ? dims[1] : 1); ++b) {
+        std::vector<size_t> row(dims.size(), DONT_CARE);
+        row[0] = a;
+        if (dims.size() > 1) {
+          row[1] = b;
+        }
+        rows_.push_back(row);
+      }
+    }
+
+    for (size_t k = 2; k < dims.size(); ++k) {
+      /* uncovered[i][vi * dims[k] + vk] */
+      std::vector<std::vector<bool>> uncovered;
+      for (size_t i = 0; i < k; ++i) {
+        uncovered.emplace_back(dims[i] * dims[k], true);
+      }
+
+      for (auto &row : rows_) {
+        size_t best = 0, best_gain = 0;
+
+        for (size_t vk = 0; vk < dims[k]; ++vk) {
+          size_t gain = 0;
+          for (size_t i = 0; i < k; ++i) {
+            if (row[i] != DONT_CARE && uncovered[i][row[i] * dims[k] + vk]) {
+              ++gain;
+            }
+          }
+
+          if (gain > best_gain) {
+            best = vk;
+            best_gain = gain;
+          }
+        }
+
+        row[k] = best;
+        for (size_t i = 0; i < k; ++i) {
+          if (row[i] != DONT_CARE) {
+            uncovered[i][row[i] * dims[k] + best] = false;
+          }
+        }
+      }
+
+      for (size_t i = 0; i < k; ++i) {
+        for (size_t vi = 0; vi < dims[i]; ++vi) {
+          for (size_t vk = 0; vk < dims[k]; ++vk) {
+            if (!uncovered[i][vi * dims[k] + vk]) {
+              continue;
+            }
+
+            auto row = std::find_if(
+                rows_.begin(), rows_.end(),
+                [i, k, vk](const std::vector<size_t> &r) {
+                  return r[k] == vk && r[i] == DONT_CARE;
+                });
+
+            if (row == rows_.end()) {
+              rows_.emplace_back(dims.size(), DONT_CARE);
+              row = rows_.end() - 1;
+              (*row)[k] = vk;
+            }
+
+            (*row)[i] = vi;
+          }
+        }
+      }
+    }
+
+    for (auto &row : rows_) {
+      std::replace(row.begin(), row.end(), DONT_CARE, size_t{0});
+    }
+  }
+
+  static size_t GreatestCommonDivisor(size_t a, size_t b) {
+    while (b != 0) {
+      size_t rest = a % b;
+      a = b;
+      b = rest;
+    }
+    return a;
+  }
+
+  std::vector<size_t> GetChoice(size_t index) const {
+    if (coverage_ == Coverage::Pairwise) {
+      return rows_.at(index);
+    }
+
+    std::vector<size_t> choice(dimensions_.size());
+    for (size_t i = dimensions_.size(); i-- > 0;) {
+      choice[i] = index % dimensions_[i];
+      index /= dimensions_[i];
+    }
+
+    return choice;
+  }
+
+ public:
+  PoolArgsGenerator(PoolArgsSpace space, Coverage coverage, size_t sample = 0,
+                    uint64_t seed = 0)
+      : space_(space), dimensions_(space.GetDimensions()), coverage_(coverage) {
+    if (coverage_ == Coverage::Pairwise) {
+      CoverPairs();
+      count_ = rows_.size();
+    } else {
+      for (size_t dimension : dimensions_) {
+        count_ *= dimension;
+      }
+    }
+
+    size_ = sample != 0 ? std::min(sample, count_) : count_;
+
+    if (size_ < count_) {
+      /* stride coprime with count visits each combination at most once */
+      stride_ = count_ / size_;
+      while (GreatestCommonDivisor(stride_, count_) != 1) {
+        ++stride_;
+      }
+      offset_ = static_cast<size_t>(seed % count_);
+    }
+  }
+
+  size_t GetSize() const {
+    return size_;
+  }
+
+  PoolArgs Get(size_t index) const {
+    return space_.Expand(GetChoice((offset_ + index * stride_) % count_));
+  }
+
+  ::testing::internal::ParamGenerator<PoolArgs> GetValues() const;
+};
+
+namespace pool_args_space {
+/*
+ * ParamGenerator -- gtest parameter generator expanding PoolArgs from
+ * PoolArgsGenerator one by one while tests are registered.
+ */
+class ParamGenerator final
+    : public ::testing::internal::ParamGeneratorInterface<PoolArgs> {
+ private:
+  PoolArgsGenerator generator_;
+
+  class Iterator final
+      : public ::testing::internal::ParamIteratorInterface<PoolArgs> {
+   private:
+    const ParamGenerator *base_;
+    size_t index_;
+    PoolArgs current_;
+
+    void Expand() {
+      if (index_ < base_->generator_.GetSize()) {
+        current_ = base_->generator_.Get(index_);
+      }
+    }
+
+   public:
+    Iterator(const ParamGenerator *base, size_t index)
+        : base_(base), index_(index) {
+      Expand();
+    }
+
+    const ::testing::internal::ParamGeneratorInterface<PoolArgs>
+        *BaseGenerator() const override {
+      return base_;
+    }
+
+    void Advance() override {
+      ++index_;
+      Expand();
+    }
+
+    ::testing::internal::ParamIteratorInterface<PoolArgs> *Clone()
+        const override {
+      return new Iterator(*this);
+    }
+
+    const PoolArgs *Current() const override {
+      return &current_;
+    }
+
+    bool Equals(const ::testing::internal::ParamIteratorInterface<PoolArgs>
+                    &other) const override {
+      return base_ == other.BaseGenerator() &&
+             index_ == static_cast<const Iterator &>(other).index_;
+    }
+  };
+
+ public:
+  explicit ParamGenerator(const PoolArgsGenerator &generator)
+      : generator_(generator) {
+  }
+
+  ::testing::internal::ParamIteratorInterface<PoolArgs> *Begin()
+      const override {
+    return new Iterator(this, 0);
+  }
+
+  ::testing::internal::ParamIteratorInterface<PoolArgs> *End() const override {
+    return new Iterator(this, generator_.GetSize());
+  }
+};
+}  // namespace pool_args_space
+
+/*
+ * GetValues -- returns generator to be passed to INSTANTIATE_TEST_CASE_P in
+ * place of ::testing::Values().
+ */
+inline ::testing::internal::ParamGenerator<PoolArgs>
+PoolArgsGenerator::GetValues() const {
+  return ::testing::internal::ParamGenerator<PoolArgs>(
+      new pool_args_space::ParamGenerator(*this));
+}
+
+#endif  // !PMDK_TESTS_SRC_TESTS_PMEMPOOLS_UTILS_POOL_ARGS_SPACE_H_
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_TESTS_PMEMPOOLS_UTILS_POOL_DATA_H_
+#define PMDK_TESTS_SRC_TESTS_PMEMPOOLS_UTILS_POOL_DATA_H_
+
+#include <libpmemobj.h>
+#include <iostream>
+#include <string>
+#include "test_utils/pattern_utils.h"
+
+namespace pool_data {
+const uint64_t PATTERN_SEED = 0x9A77E53;
+
+/*
+ * CreateObjPool -- creates obj pool with root object of given size filled
+ * with known pattern.
+ */
+static inline int CreateObjPool(const std::string &path, size_t data_size) {
+  PMEMobjpool *pop = pmemobj_create(path.c_str(), nullptr, 0, 0644);
+
+  if (pop == nullptr) {
+    std::cerr << pmemobj_errormsg() << std::endl;
+    return -1;
+  }
+
+  void *root = pmemobj_direct(pmemobj_root(pop, data_size));
+
+  if (root == nullptr) {
+    std::cerr << pmemobj_errormsg() << std::endl;
+    pmemobj_close(pop);
+    return -1;
+  }
+
+  /* pmemobj_persist also copies data to replicas of the pool */
+  pattern_utils::Fill(static_cast<char *>(root), data_size, PATTERN_SEED, 0,
+                      false);
+  pmemobj_persist(pop, root, data_size);
+  pmemobj_close(pop);
+
+  return 0;
+}
+
+/*
+ * VerifyObjPool -- opens obj pool and makes sure that its root object
+ * contains pattern written by CreateObjPool.
+ */
+static inline int VerifyObjPool(const std::string &path, size_t data_size) {
+  PMEMobjpool *pop = pmemobj_open(path.c_str(), nullptr);
+
+  if (pop == nullptr) {
+    std::cerr << pmemobj_errormsg() << std::endl;
+    return -1;
+  }
+
+  const char *root =
+      static_cast<const char *>(pmemobj_direct(pmemobj_root(pop, data_size)));
+
+  if (root == nullptr) {
+    std::cerr << pmemobj_errormsg() << std::endl;
+    pmemobj_close(pop);
+    return -1;
+  }
+
+  long long mismatch_offset =
+      pattern_utils::Verify(root, data_size, PATTERN_SEED);
+
+  if (mismatch_offset != -1) {
+    std::cerr << "Pool data mismatch at offset " << mismatch_offset
+              << std::endl;
+  }
+
+  pmemobj_close(pop);
+
+  return mismatch_offset == -1 ? 0 : -1;
+}
+}  // namespace pool_data
+
+#endif  // !PMDK_TESTS_SRC_TESTS_PMEMPOOLS_UTILS_POOL_DATA_H_
@@ -44,6 +44,12 @@
 
 enum class PoolType { Obj, Blk, Log, None, Count };
 
+enum class Interface { CLI, API };
+
+static inline void PrintTo(Interface interface, std::ostream *os) {
+  *os << (interface == Interface::CLI ? "CLI" : "API");
+}
+
 enum class OptionType { Long, Short, ShortNoSpace };
 
 enum class Option {
@@ -204,4 +210,52 @@ static inline int GetPoolMode(const PoolArgs &pool_args) {
 }
 }  // namespace struct_utils
 
+/*
+ * PrintTo -- prints test parameters on single line, so that they can be
+ * listed with --gtest_list_tests and compared between runs.
+ */
+static inline void PrintTo(PoolType pool_type, std::ostream *os) {
+  switch (pool_type) {
+    case PoolType::Obj:
+      *os << "obj";
+      break;
+    case PoolType::Blk:
+      *os << "blk";
+      break;
+    case PoolType::Log:
+      *os << "log";
+      break;
+    default:
+      *os << "none";
+      break;
+  }
+}
+
+static inline void PrintTo(const PoolArgs &pool_args, std::ostream *os) {
+  PrintTo(pool_args.pool_type, os);
+  *os << " " << struct_utils::CombineArguments(pool_args.args);
+
+  if (!pool_args.err_msg.empty()) {
+    *os << "error: ";
+    for (char c : pool_args.err_msg) {
+      *os << (c == '\n' ? std::string("\\n") : std::string(1, c));
+    }
+  }
+}
+
+static inline void PrintTo(const PoolInherit &pool_inherit, std::ostream *os) {
+  *os << "base: ";
+  PrintTo(pool_inherit.pool_base, os);
+  *os << "inherited: ";
+  PrintTo(pool_inherit.pool_inherited, os);
+}
+
+static inline void PrintTo(const PoolsetArgs &poolset_args, std::ostream *os) {
+  PrintTo(poolset_args.args, os);
+  *os << "poolset:";
+  for (const auto &line : poolset_args.poolset.GetContent()) {
+    *os << " " << line << ";";
+  }
+}
+
 #endif  // !PMDK_TESTS_SRC_TESTS_PMEMPOOLS_PMEMPOOL_CREATE_STRUCTURES_H_
@@ -36,8 +36,66 @@
 #define stat64 _stat64
 #endif // _WIN32
 
+#ifdef USE_LIBURING
+#include <fcntl.h>
+#include <unistd.h>
+#include "io_uring_batch.h"
+#endif  // USE_LIBURING
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
 #include "api_c.h"
 
+#ifdef USE_LIBURING
+namespace {
+/*
+ * OpenFiles -- opens all files in a batch. Indices of opened files are
+ * stored in opened, also when opening some other files failed, so that all
+ * of them are closed by CloseFiles. Failures are reported.
+ */
+int OpenFiles(IoUringBatch &batch, const std::vector<std::string> &paths,
+              int flags, std::vector<int> &fds, std::vector<size_t> &opened) {
+  int ret = batch.Run(paths.size(),
+                      [&](struct io_uring_sqe *sqe, size_t i) {
+                        io_uring_prep_openat(sqe, AT_FDCWD, paths[i].c_str(),
+                                             flags, 0664);
+                      },
+                      fds);
+
+  opened.clear();
+  for (size_t i = 0; i < fds.size(); ++i) {
+    if (fds[i] >= 0) {
+      opened.push_back(i);
+    } else {
+      std::cerr << "Unable to open file " << paths[i] << ": "
+                << strerror(-fds[i]) << std::endl;
+      ret = -1;
+    }
+  }
+
+  return ret;
+}
+
+void CloseFiles(IoUringBatch &batch, const std::vector<int> &fds,
+                const std::vector<size_t> &opened) {
+  std::vector<int> results;
+
+  batch.Run(opened.size(),
+            [&](struct io_uring_sqe *sqe, size_t j) {
+              io_uring_prep_close(sqe, fds[opened[j]]);
+            },
+            results);
+
+  for (size_t j = 0; j < opened.size(); ++j) {
+    if (results[j] == -ECANCELED) {
+      close(fds[opened[j]]);
+    }
+  }
+}
+}
+#endif  // USE_LIBURING
+
 int ApiC::CreateFileT(const std::string &path, const std::string &content) {
   std::ofstream file{path, std::ios::binary};
 
@@ -70,15 +128,96 @@ int ApiC::ReadFile(const std::string &path, std::string &content) {
     return -1;
   }
 
-  std::string line;
+  content.resize(static_cast<size_t>(file.tellg()));
+  file.seekg(0);
 
-  while (std::getline(file, line)) {
-    content += line;
+  if (!file.read(&content[0], content.size())) {
+    std::cerr << "File reading failed" << std::endl;
+    content.clear();
+    return -1;
   }
 
   return 0;
 }
 
+long long ApiC::CompareMemory(const char *first, const char *second,
+                              size_t length) {
+  const size_t COMPARE_BLOCK_SIZE = 64 * KIBIBYTE;
+
+  /* memcmp is vectorized by libc, but tells only whether blocks differ */
+  for (size_t block = 0; block < length; block += COMPARE_BLOCK_SIZE) {
+    size_t block_length = std::min(COMPARE_BLOCK_SIZE, length - block);
+
+    if (memcmp(first + block, second + block, block_length) == 0) {
+      continue;
+    }
+
+    size_t offset = block;
+    uint64_t first_word, second_word;
+
+    for (; offset + sizeof(uint64_t) <= block + block_length;
+         offset += sizeof(uint64_t)) {
+      memcpy(&first_word, first + offset, sizeof(uint64_t));
+      memcpy(&second_word, second + offset, sizeof(uint64_t));
+
+      if (first_word != second_word) {
+        break;
+      }
+    }
+
+    while (first[offset] == second[offset]) {
+      ++offset;
+    }
+
+    return static_cast<long long>(offset);
+  }
+
+  return -1;
+}
+
+int ApiC::CompareFiles(const std::string &first_path,
+                       const std::string &second_path,
+                       long long &mismatch_offset) {
+  MappedFile first, second;
+
+  if (first.Map(first_path) != 0 || second.Map(second_path) != 0) {
+    return -1;
+  }
+
+  size_t length = std::min(first.GetSize(), second.GetSize());
+  mismatch_offset = CompareMemory(first.GetData(), second.GetData(), length);
+
+  /* shorter file differs from the longer one right after its end */
+  if (mismatch_offset == -1 && first.GetSize() != second.GetSize()) {
+    mismatch_offset = static_cast<long long>(length);
+  }
+
+  return 0;
+}
+
+int ApiC::CompareFileRegions(const std::string &first_path,
+                             size_t first_offset,
+                             const std::string &second_path,
+                             size_t second_offset, size_t length,
+                             long long &mismatch_offset) {
+  MappedFile first, second;
+
+  if (first.Map(first_path) != 0 || second.Map(second_path) != 0) {
+    return -1;
+  }
+
+  if (first_offset + length > first.GetSize() ||
+      second_offset + length > second.GetSize()) {
+    std::cerr << "Compared region exceeds size of file" << std::endl;
+    return -1;
+  }
+
+  mismatch_offset = CompareMemory(first.GetData() + first_offset,
+                                  second.GetData() + second_offset, length);
+
+  return 0;
+}
+
 bool ApiC::RegularFileExists(const std::string &path) {
   struct stat64 file_stat;
 
@@ -112,6 +251,38 @@ long long ApiC::GetFileSize(const std::string &path) {
 std::vector<long long> ApiC::GetFilesSize(
     const std::vector<std::string> &paths) {
   std::vector<long long> sizes;
+
+#ifdef USE_LIBURING
+  IoUringBatch *batch = IoUringBatch::Get(paths.size(), {IORING_OP_STATX});
+
+  if (batch != nullptr) {
+    std::vector<struct statx> stats(paths.size());
+    std::vector<int> results;
+
+    if (batch->Run(paths.size(),
+                   [&](struct io_uring_sqe *sqe, size_t i) {
+                     io_uring_prep_statx(sqe, AT_FDCWD, paths[i].c_str(), 0,
+                                         STATX_SIZE, &stats[i]);
+                   },
+                   results) != 0) {
+      return sizes;
+    }
+
+    for (size_t i = 0; i < paths.size(); ++i) {
+      if (results[i] < 0) {
+        std::cerr << "Unable to get file size: " << strerror(-results[i])
+                  << std::endl;
+        sizes.clear();
+        break;
+      }
+
+      sizes.push_back(static_cast<long long>(stats[i].stx_size));
+    }
+
+    return sizes;
+  }
+#endif  // USE_LIBURING
+
   long long file_size;
 
   for (const auto &path : paths) {
@@ -127,6 +298,153 @@ std::vector<long long> ApiC::GetFilesSize(
   return sizes;
 }
 
+int ApiC::AllocateFilesSpace(const std::vector<std::string> &paths,
+                             const std::vector<size_t> &lengths) {
+  if (paths.size() != lengths.size()) {
+    std::cerr << "Number of files and lengths differ" << std::endl;
+    return -1;
+  }
+
+  int ret = 0;
+
+#ifdef USE_LIBURING
+  IoUringBatch *batch = IoUringBatch::Get(
+      paths.size(), {IORING_OP_OPENAT, IORING_OP_FALLOCATE, IORING_OP_CLOSE});
+
+  if (batch != nullptr) {
+    std::vector<int> fds, results;
+    std::vector<size_t> opened;
+
+    ret = OpenFiles(*batch, paths, O_CREAT | O_RDWR, fds, opened);
+
+    if (batch->Run(opened.size(),
+                   [&](struct io_uring_sqe *sqe, size_t j) {
+                     io_uring_prep_fallocate(sqe, fds[opened[j]], 0, 0,
+                                             lengths[opened[j]]);
+                   },
+                   results) != 0) {
+      results.assign(opened.size(), -EIO);
+    }
+
+    for (size_t j = 0; j < opened.size(); ++j) {
+      size_t i = opened[j];
+
+      /* file systems without fallocate support need emulated allocation */
+      if (results[j] == -EOPNOTSUPP) {
+        results[j] = -posix_fallocate(fds[i], 0, lengths[i]);
+      }
+
+      if (results[j] != 0) {
+        std::cerr << "Unable to allocate disk space for " << paths[i] << ": "
+                  << strerror(-results[j]) << std::endl;
+        ret = -1;
+      }
+    }
+
+    CloseFiles(*batch, fds, opened);
+
+    for (size_t j = 0; j < opened.size(); ++j) {
+      if (results[j] != 0) {
+        RemoveFile(paths[opened[j]]);
+      }
+    }
+
+    return ret;
+  }
+#endif  // USE_LIBURING
+
+  for (size_t i = 0; i < paths.size(); ++i) {
+    if (AllocateFileSpace(paths[i], lengths[i]) != 0) {
+      ret = -1;
+    }
+  }
+
+  return ret;
+}
+
+int ApiC::SyncFiles(const std::vector<std::string> &paths) {
+  int ret = 0;
+
+#ifdef USE_LIBURING
+  IoUringBatch *batch = IoUringBatch::Get(
+      paths.size(), {IORING_OP_OPENAT, IORING_OP_FSYNC, IORING_OP_CLOSE});
+
+  if (batch != nullptr) {
+    std::vector<int> fds, results;
+    std::vector<size_t> opened;
+
+    ret = OpenFiles(*batch, paths, O_RDONLY, fds, opened);
+
+    if (batch->Run(opened.size(),
+                   [&](struct io_uring_sqe *sqe, size_t j) {
+                     io_uring_prep_fsync(sqe, fds[opened[j]], 0);
+                   },
+                   results) != 0) {
+      ret = -1;
+    }
+
+    for (size_t j = 0; j < results.size(); ++j) {
+      if (results[j] < 0) {
+        std::cerr << "Unable to flush file " << paths[opened[j]] << ": "
+                  << strerror(-results[j]) << std::endl;
+        ret = -1;
+      }
+    }
+
+    CloseFiles(*batch, fds, opened);
+
+    return ret;
+  }
+#endif  // USE_LIBURING
+
+  for (const auto &path : paths) {
+    if (SyncFile(path) != 0) {
+      ret = -1;
+    }
+  }
+
+  return ret;
+}
+
+int ApiC::RemoveFiles(const std::vector<std::string> &paths) {
+  int ret = 0;
+
+#ifdef USE_LIBURING
+  IoUringBatch *batch = IoUringBatch::Get(paths.size(), {IORING_OP_UNLINKAT});
+
+  if (batch != nullptr) {
+    std::vector<int> results;
+
+    if (batch->Run(paths.size(),
+                   [&](struct io_uring_sqe *sqe, size_t i) {
+                     io_uring_prep_unlinkat(sqe, AT_FDCWD, paths[i].c_str(),
+                                            0);
+                   },
+                   results) != 0) {
+      return -1;
+    }
+
+    for (size_t i = 0; i < paths.size(); ++i) {
+      if (results[i] < 0) {
+        std::cerr << "Unable to remove file " << paths[i] << ": "
+                  << strerror(-results[i]) << std::endl;
+        ret = -1;
+      }
+    }
+
+    return ret;
+  }
+#endif  // USE_LIBURING
+
+  for (const auto &path : paths) {
+    if (RemoveFile(path) != 0) {
+      ret = -1;
+    }
+  }
+
+  return ret;
+}
+
 int ApiC::SetFilePermission(const std::string &path, int permissions) {
   int ret = chmod(path.c_str(), permissions);
 
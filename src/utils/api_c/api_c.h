@@ -39,8 +39,16 @@
 #include <string>
 #include <vector>
 #include "constants.h"
+#include "mapped_file.h"
 #include "non_copyable/non_copyable.h"
 
+struct FileExtent {
+  unsigned long long logical;
+  unsigned long long physical;
+  unsigned long long length;
+  bool unwritten;
+};
+
 class ApiC final : NonCopyable {
  public:
   static int GetExecutablePath(std::string &path);
@@ -48,19 +56,46 @@ class ApiC final : NonCopyable {
   static int CreateFileT(const std::string &path,
                          const std::vector<std::string> &content);
   static int AllocateFileSpace(const std::string &path, size_t length);
+  static int AllocateFilesSpace(const std::vector<std::string> &paths,
+                                const std::vector<size_t> &lengths);
+  static int TruncateFile(const std::string &path, size_t length);
+  static int CloneFile(const std::string &src, const std::string &dst);
+  static int SyncFile(const std::string &path);
+  static int SyncFiles(const std::vector<std::string> &paths);
   static int ReadFile(const std::string &path, std::string &content);
+  static long long CompareMemory(const char *first, const char *second,
+                                 size_t length);
+  static int CompareFiles(const std::string &first_path,
+                          const std::string &second_path,
+                          long long &mismatch_offset);
+  static int CompareFileRegions(const std::string &first_path,
+                                size_t first_offset,
+                                const std::string &second_path,
+                                size_t second_offset, size_t length,
+                                long long &mismatch_offset);
   static bool RegularFileExists(const std::string &path);
   static long long GetFileSize(const std::string &path);
+  static long long GetAllocatedSize(const std::string &path);
+  static int GetFileExtents(const std::string &path,
+                            std::vector<FileExtent> &extents);
+  static int EvictFromCache(const std::string &path);
   static std::vector<long long> GetFilesSize(
       const std::vector<std::string> &paths);
   static unsigned short GetFilePermission(const std::string &path);
   static int SetFilePermission(const std::string &path, int permissions);
   static int RemoveFile(const std::string &path);
+  static int RemoveFiles(const std::vector<std::string> &paths);
   static int CreateDirectoryT(const std::string &dir);
   static bool DirectoryExists(const std::string &dir);
   static int CleanDirectory(const std::string &dir);
   static int RemoveDirectoryT(const std::string &dir);
   static long long GetFreeSpaceT(const std::string &dir);
+  static int GetDeviceId(const std::string &path, unsigned long long &id);
+  static long long GetPageCacheSize();
+  static int GetPageFaults(long long &minor, long long &major);
+  static int GetIoCounters(long long &read_bytes, long long &write_bytes);
+  static int GetNumaNodeCpus(int node, std::vector<unsigned> &cpus);
+  static int PinThreadToNumaNode(int node);
 };
 
 #endif  // !PMDK_TESTS_SRC_UTILS_API_C_API_C_H_
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef USE_LIBURING
+
+#include "io_uring_batch.h"
+#include <errno.h>
+#include <string.h>
+#include <iostream>
+
+IoUringBatch::IoUringBatch() {
+  Init();
+}
+
+IoUringBatch::~IoUringBatch() {
+  Exit();
+}
+
+void IoUringBatch::Init() {
+  initialized_ = io_uring_queue_init(QUEUE_DEPTH, &ring_, 0) == 0;
+
+  if (initialized_) {
+    probe_ = io_uring_get_probe_ring(&ring_);
+  }
+}
+
+void IoUringBatch::Exit() {
+  if (probe_ != nullptr) {
+    io_uring_free_probe(probe_);
+    probe_ = nullptr;
+  }
+
+  if (initialized_) {
+    io_uring_queue_exit(&ring_);
+    initialized_ = false;
+  }
+}
+
+bool IoUringBatch::IsSupported(std::initializer_list<int> opcodes) const {
+  if (probe_ == nullptr) {
+    return false;
+  }
+
+  for (int opcode : opcodes) {
+    if (!io_uring_opcode_supported(probe_, opcode)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+IoUringBatch *IoUringBatch::Get(size_t count,
+                                std::initializer_list<int> opcodes) {
+  if (count < MIN_BATCH_SIZE) {
+    return nullptr;
+  }
+
+  thread_local IoUringBatch batch;
+
+  return batch.IsSupported(opcodes) ? &batch : nullptr;
+}
+
+int IoUringBatch::Run(size_t count, const Prepare &prepare,
+                      std::vector<int> &results) {
+  size_t submitted = 0;
+  size_t completed = 0;
+  struct io_uring_cqe *cqes[QUEUE_DEPTH];
+  bool failed = false;
+
+  results.assign(count, -ECANCELED);
+
+  while (completed < count) {
+    while (submitted < count && submitted - completed < QUEUE_DEPTH) {
+      struct io_uring_sqe *sqe = io_uring_get_sqe(&ring_);
+
+      if (sqe == nullptr) {
+        break;
+      }
+
+      prepare(sqe, submitted);
+      sqe->user_data = submitted++;
+    }
+
+    int ret = io_uring_submit_and_wait(&ring_, 1);
+
+    if (ret == -EINTR) {
+      continue;
+    }
+
+    if (ret < 0) {
+      std::cerr << "io_uring submission failed: " << strerror(-ret)
+                << std::endl;
+      failed = true;
+      break;
+    }
+
+    unsigned reaped = io_uring_peek_batch_cqe(&ring_, cqes, QUEUE_DEPTH);
+    for (unsigned i = 0; i < reaped; ++i) {
+      results[cqes[i]->user_data] = cqes[i]->res;
+    }
+
+    io_uring_cq_advance(&ring_, reaped);
+    completed += reaped;
+  }
+
+  if (!failed) {
+    return 0;
+  }
+
+  /*
+   * Kernel may still write to buffers of operations it has taken, so wait
+   * for them. Operations left in submission queue are dropped along with
+   * the ring, which is replaced with a new one.
+   */
+  size_t in_kernel = submitted - completed - io_uring_sq_ready(&ring_);
+
+  while (in_kernel > 0) {
+    struct io_uring_cqe *cqe = nullptr;
+    int ret = io_uring_wait_cqe(&ring_, &cqe);
+
+    if (ret == -EINTR) {
+      continue;
+    }
+
+    if (ret < 0) {
+      std::cerr << "Unable to wait for io_uring completion: " << strerror(-ret)
+                << std::endl;
+      break;
+    }
+
+    results[cqe->user_data] = cqe->res;
+    io_uring_cqe_seen(&ring_, cqe);
+    --in_kernel;
+  }
+
+  Exit();
+  Init();
+
+  return -1;
+}
+
+#endif  // USE_LIBURING
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_API_C_IO_URING_BATCH_H_
+#define PMDK_TESTS_SRC_UTILS_API_C_IO_URING_BATCH_H_
+
+#ifdef USE_LIBURING
+
+#include <liburing.h>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+#include "non_copyable/non_copyable.h"
+
+/*
+ * IoUringBatch -- submits the same kind of operation for many files through
+ * io_uring, keeping up to queue depth operations in flight. Each thread
+ * reuses its own ring. Batches too small to benefit from io_uring and
+ * operations not supported by running kernel are refused by Get(), so that
+ * caller can fall back to blocking syscalls.
+ */
+class IoUringBatch final : NonCopyable {
+ private:
+  static const unsigned QUEUE_DEPTH = 64;
+  struct io_uring ring_;
+  struct io_uring_probe *probe_ = nullptr;
+  bool initialized_ = false;
+
+  IoUringBatch();
+  void Init();
+  void Exit();
+  bool IsSupported(std::initializer_list<int> opcodes) const;
+
+ public:
+  using Prepare = std::function<void(struct io_uring_sqe *, size_t)>;
+
+  /* smaller batches are faster with blocking syscalls */
+  static const size_t MIN_BATCH_SIZE = 4;
+
+  ~IoUringBatch();
+
+  /*
+   * Get -- returns ring of calling thread if count operations are worth
+   * batching and all opcodes are supported, nullptr otherwise.
+   */
+  static IoUringBatch *Get(size_t count, std::initializer_list<int> opcodes);
+
+  /*
+   * Run -- prepares and submits count operations, storing result of each
+   * one in results. Operations which did not complete are reported as
+   * -ECANCELED. Returns only when kernel no longer uses any of them.
+   */
+  int Run(size_t count, const Prepare &prepare, std::vector<int> &results);
+};
+
+#endif  // USE_LIBURING
+
+#endif  // !PMDK_TESTS_SRC_UTILS_API_C_IO_URING_BATCH_H_
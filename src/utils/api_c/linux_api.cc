@@ -36,8 +36,17 @@
 #include <fcntl.h>
 #include <fts.h>
 #include <libgen.h>
+#include <linux/fiemap.h>
+#include <linux/fs.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
 #include <sys/statvfs.h>
 #include <unistd.h>
+#include <algorithm>
+#include <sstream>
 #include "api_c.h"
 
 int ApiC::AllocateFileSpace(const std::string &path, size_t length) {
@@ -46,7 +55,7 @@ int ApiC::AllocateFileSpace(const std::string &path, size_t length) {
     return -1;
   }
 
-  int fd = open(path.c_str(), O_CREAT | O_RDWR);
+  int fd = open(path.c_str(), O_CREAT | O_RDWR, 0664);
 
   if (fd == -1) {
     std::cerr << "Unable to create file: " << strerror(errno) << std::endl;
@@ -54,17 +63,181 @@ int ApiC::AllocateFileSpace(const std::string &path, size_t length) {
   }
 
   int ret = posix_fallocate(fd, 0, static_cast<off_t>(length));
+  close(fd);
 
   if (ret != 0) {
-    std::cerr << "Unable to allocate disk space: " << strerror(errno)
+    std::cerr << "Unable to allocate disk space: " << strerror(ret)
               << std::endl;
-    close(fd);
     RemoveFile(path);
   }
 
   return ret;
 }
 
+int ApiC::TruncateFile(const std::string &path, size_t length) {
+  if (static_cast<off_t>(length) < 0) {
+    std::cerr << "length should be > 0" << std::endl;
+    return -1;
+  }
+
+  int fd = open(path.c_str(), O_CREAT | O_RDWR, 0664);
+
+  if (fd == -1) {
+    std::cerr << "Unable to create file: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  int ret = ftruncate(fd, static_cast<off_t>(length));
+
+  if (ret != 0) {
+    std::cerr << "Unable to set file size: " << strerror(errno) << std::endl;
+  }
+
+  close(fd);
+  return ret;
+}
+
+int ApiC::SyncFile(const std::string &path) {
+  int fd = open(path.c_str(), O_RDONLY);
+
+  if (fd == -1) {
+    std::cerr << "Unable to open file: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  int ret = fsync(fd);
+
+  if (ret != 0) {
+    std::cerr << "Unable to flush file: " << strerror(errno) << std::endl;
+  }
+
+  close(fd);
+  return ret;
+}
+
+int ApiC::CloneFile(const std::string &src, const std::string &dst) {
+  int src_fd = open(src.c_str(), O_RDONLY);
+
+  if (src_fd == -1) {
+    std::cerr << "Unable to open file: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  struct stat64 src_stat;
+  int dst_fd = -1;
+
+  if (fstat64(src_fd, &src_stat) != 0 ||
+      (dst_fd = open(dst.c_str(), O_CREAT | O_TRUNC | O_WRONLY,
+                     src_stat.st_mode & 0777)) == -1) {
+    std::cerr << "Unable to create file: " << strerror(errno) << std::endl;
+    close(src_fd);
+    return -1;
+  }
+
+  int ret = 0;
+
+  /* share extents of source file if file system supports it */
+  if (ioctl(dst_fd, FICLONE, src_fd) != 0) {
+    off64_t remaining = src_stat.st_size;
+
+    /* otherwise copy data in kernel, falling back to read/write */
+    while (remaining > 0) {
+      ssize_t copied =
+          copy_file_range(src_fd, nullptr, dst_fd, nullptr, remaining, 0);
+
+      if (copied <= 0) {
+        break;
+      }
+      remaining -= copied;
+    }
+
+    if (remaining > 0 &&
+        lseek64(src_fd, src_stat.st_size - remaining, SEEK_SET) != -1) {
+      std::vector<char> buffer(MEBIBYTE);
+      ssize_t count = 0;
+
+      while (remaining > 0 &&
+             (count = read(src_fd, buffer.data(), buffer.size())) > 0 &&
+             write(dst_fd, buffer.data(), count) == count) {
+        remaining -= count;
+      }
+    }
+
+    if (remaining > 0) {
+      std::cerr << "Unable to copy file: " << strerror(errno) << std::endl;
+      ret = -1;
+    }
+  }
+
+  close(src_fd);
+  close(dst_fd);
+
+  if (ret != 0) {
+    RemoveFile(dst);
+  }
+
+  return ret;
+}
+
+int MappedFile::Map(const std::string &path, MapMode mode, bool populate) {
+  if (Unmap() != 0) {
+    return -1;
+  }
+
+  int fd = open(path.c_str(), mode == MapMode::ReadOnly ? O_RDONLY : O_RDWR);
+
+  if (fd == -1) {
+    std::cerr << "Unable to open file: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  struct stat64 file_stat;
+
+  if (fstat64(fd, &file_stat) != 0) {
+    std::cerr << "Unable to get file size: " << strerror(errno) << std::endl;
+    close(fd);
+    return -1;
+  }
+
+  /* empty file cannot be mapped, but is a valid empty range */
+  if (file_stat.st_size == 0) {
+    close(fd);
+    return 0;
+  }
+
+  void *addr = mmap(
+      nullptr, static_cast<size_t>(file_stat.st_size),
+      mode == MapMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE,
+      MAP_SHARED | (populate ? MAP_POPULATE : 0), fd, 0);
+  close(fd);
+
+  if (addr == MAP_FAILED) {
+    std::cerr << "Unable to map file: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  data_ = static_cast<char *>(addr);
+  size_ = static_cast<size_t>(file_stat.st_size);
+
+  return 0;
+}
+
+int MappedFile::Unmap() {
+  if (data_ == nullptr) {
+    return 0;
+  }
+
+  if (munmap(data_, size_) != 0) {
+    std::cerr << "Unable to unmap file: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  data_ = nullptr;
+  size_ = 0;
+
+  return 0;
+}
+
 int ApiC::GetExecutablePath(std::string &path) {
   char file_path[FILENAME_MAX + 1] = {0};
   ssize_t count = readlink("/proc/self/exe", file_path, FILENAME_MAX);
@@ -90,6 +263,167 @@ long long ApiC::GetFreeSpaceT(const std::string &dir) {
   return fs.f_bsize * fs.f_bavail;
 }
 
+int ApiC::GetDeviceId(const std::string &path, unsigned long long &id) {
+  struct stat64 file_stat;
+
+  /* file may not exist yet, so fall back to its directory */
+  if (stat64(path.c_str(), &file_stat) != 0) {
+    std::vector<char> copy(path.begin(), path.end());
+    copy.push_back('\0');
+
+    if (stat64(dirname(copy.data()), &file_stat) != 0) {
+      std::cerr << "Unable to get device: " << strerror(errno) << std::endl;
+      return -1;
+    }
+  }
+
+  id = static_cast<unsigned long long>(file_stat.st_dev);
+  return 0;
+}
+
+long long ApiC::GetAllocatedSize(const std::string &path) {
+  struct stat64 file_stat;
+
+  if (stat64(path.c_str(), &file_stat) != 0) {
+    std::cerr << "Unable to get allocated size: " << strerror(errno)
+              << std::endl;
+    return -1;
+  }
+
+  /* st_blocks is always given in 512-byte units */
+  return static_cast<long long>(file_stat.st_blocks) * 512;
+}
+
+int ApiC::GetFileExtents(const std::string &path,
+                         std::vector<FileExtent> &extents) {
+  const unsigned EXTENTS_PER_CALL = 512;
+  int fd = open(path.c_str(), O_RDONLY);
+
+  if (fd == -1) {
+    std::cerr << "Unable to open file: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  std::vector<char> buffer(sizeof(struct fiemap) +
+                           EXTENTS_PER_CALL * sizeof(struct fiemap_extent));
+  struct fiemap *map = reinterpret_cast<struct fiemap *>(buffer.data());
+  unsigned long long start = 0;
+  bool last = false;
+
+  extents.clear();
+  while (!last) {
+    std::fill(buffer.begin(), buffer.end(), 0);
+    map->fm_start = start;
+    map->fm_length = FIEMAP_MAX_OFFSET - start;
+    map->fm_flags = FIEMAP_FLAG_SYNC;
+    map->fm_extent_count = EXTENTS_PER_CALL;
+
+    if (ioctl(fd, FS_IOC_FIEMAP, map) == -1) {
+      std::cerr << "Unable to get extent map: " << strerror(errno)
+                << std::endl;
+      close(fd);
+      return -1;
+    }
+
+    if (map->fm_mapped_extents == 0) {
+      break;
+    }
+
+    for (unsigned i = 0; i < map->fm_mapped_extents; ++i) {
+      const struct fiemap_extent &extent = map->fm_extents[i];
+      extents.push_back({extent.fe_logical, extent.fe_physical,
+                         extent.fe_length,
+                         (extent.fe_flags & FIEMAP_EXTENT_UNWRITTEN) != 0});
+      start = extent.fe_logical + extent.fe_length;
+      last = (extent.fe_flags & FIEMAP_EXTENT_LAST) != 0;
+    }
+  }
+
+  close(fd);
+  return 0;
+}
+
+int ApiC::EvictFromCache(const std::string &path) {
+  int fd = open(path.c_str(), O_RDONLY);
+
+  if (fd == -1) {
+    std::cerr << "Unable to open file: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  int ret = 0;
+
+  /* dirty pages are not dropped, so they have to be written back first */
+  if (fsync(fd) != 0) {
+    std::cerr << "Unable to flush file: " << strerror(errno) << std::endl;
+    ret = -1;
+  } else if ((ret = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED)) != 0) {
+    std::cerr << "Unable to evict file from page cache: " << strerror(ret)
+              << std::endl;
+    ret = -1;
+  }
+
+  close(fd);
+  return ret;
+}
+
+long long ApiC::GetPageCacheSize() {
+  std::ifstream meminfo{"/proc/meminfo"};
+  std::string line;
+  const std::string CACHED = "Cached:";
+
+  while (std::getline(meminfo, line)) {
+    if (line.compare(0, CACHED.size(), CACHED) == 0) {
+      return std::stoll(line.substr(CACHED.size())) * KIBIBYTE;
+    }
+  }
+
+  std::cerr << "Unable to read page cache size from /proc/meminfo"
+            << std::endl;
+  return -1;
+}
+
+int ApiC::GetPageFaults(long long &minor, long long &major) {
+  struct rusage usage;
+
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    std::cerr << "Unable to get resource usage: " << strerror(errno)
+              << std::endl;
+    return -1;
+  }
+
+  minor = usage.ru_minflt;
+  major = usage.ru_majflt;
+
+  return 0;
+}
+
+int ApiC::GetIoCounters(long long &read_bytes, long long &write_bytes) {
+  std::ifstream io{"/proc/self/io"};
+  std::string key;
+  long long value;
+  int found = 0;
+
+  /* bytes which process caused to be fetched from or sent to storage */
+  while (io >> key >> value) {
+    if (key == "read_bytes:") {
+      read_bytes = value;
+      ++found;
+    } else if (key == "write_bytes:") {
+      write_bytes = value;
+      ++found;
+    }
+  }
+
+  if (found != 2) {
+    std::cerr << "Unable to read I/O counters from /proc/self/io"
+              << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
 int ApiC::CreateDirectoryT(const std::string &dir) {
   if (mkdir(dir.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH) == -1) {
     std::cerr << "mkdir failed: " << strerror(errno) << std::endl;
@@ -105,6 +439,7 @@ int ApiC::CleanDirectory(const std::string &dir) {
   int options = FTS_COMFOLLOW | FTS_LOGICAL | FTS_NOCHDIR;
   int ret = 0;
   char *d[] = {(char *)dir.c_str(), nullptr};
+  std::vector<std::string> files;
 
   fts = fts_open(d, options, nullptr);
 
@@ -130,17 +465,18 @@ int ApiC::CleanDirectory(const std::string &dir) {
         }
         break;
       case FTS_F:
-        if (RemoveFile(f_sent->fts_path) != 0) {
-          std::cerr << "Unable to remove file: " << f_sent->fts_path
-                    << std::endl;
-          ret = -1;
-        }
+        files.emplace_back(f_sent->fts_path);
         break;
       default:
         break;
     }
   }
 
+  /* files are removed at once, so that removal can be batched */
+  if (RemoveFiles(files) != 0) {
+    ret = -1;
+  }
+
   if (fts_close(fts) != 0) {
     std::cerr << "fts_close failed: " << strerror(errno) << std::endl;
     ret = -1;
@@ -160,4 +496,56 @@ int ApiC::RemoveDirectoryT(const std::string &dir) {
   return 0;
 }
 
+int ApiC::GetNumaNodeCpus(int node, std::vector<unsigned> &cpus) {
+  std::string cpu_list;
+  std::string path = "/sys/devices/system/node/node" + std::to_string(node) +
+                     "/cpulist";
+
+  std::ifstream file{path};
+  if (!file || !std::getline(file, cpu_list)) {
+    std::cerr << "Unable to read CPU list of NUMA node " << node << std::endl;
+    return -1;
+  }
+
+  /* CPU list format: "0-3,8,10-11" */
+  std::istringstream stream(cpu_list);
+  std::string range;
+  while (std::getline(stream, range, ',')) {
+    size_t dash = range.find('-');
+    unsigned first = std::stoul(range.substr(0, dash));
+    unsigned last =
+        dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+
+    for (unsigned cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+
+  return 0;
+}
+
+int ApiC::PinThreadToNumaNode(int node) {
+  std::vector<unsigned> cpus;
+
+  if (GetNumaNodeCpus(node, cpus) != 0 || cpus.empty()) {
+    return -1;
+  }
+
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (unsigned cpu : cpus) {
+    CPU_SET(cpu, &cpu_set);
+  }
+
+  int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+
+  if (ret != 0) {
+    std::cerr << "Unable to pin thread to NUMA node " << node << ": "
+              << strerror(ret) << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
 #endif  // __linux__
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_API_C_MAPPED_FILE_H_
+#define PMDK_TESTS_SRC_UTILS_API_C_MAPPED_FILE_H_
+
+#include <string>
+#include "non_copyable/non_copyable.h"
+
+enum class MapMode { ReadOnly, ReadWrite };
+
+/*
+ * MappedFile -- maps whole file into memory until it is unmapped or the
+ * object is destroyed. With populate set, all pages are faulted in while
+ * mapping (MAP_POPULATE on Linux), so that later accesses are not slowed
+ * down by page faults.
+ */
+class MappedFile final : NonCopyable {
+ private:
+  char *data_ = nullptr;
+  size_t size_ = 0;
+#ifdef _WIN32
+  void *mapping_ = nullptr;
+#endif  // _WIN32
+
+ public:
+  MappedFile() = default;
+  ~MappedFile() {
+    Unmap();
+  }
+
+  int Map(const std::string &path, MapMode mode = MapMode::ReadOnly,
+          bool populate = false);
+  int Unmap();
+
+  bool IsMapped() const {
+    return data_ != nullptr;
+  }
+  char *GetData() const {
+    return data_;
+  }
+  size_t GetSize() const {
+    return size_;
+  }
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_API_C_MAPPED_FILE_H_
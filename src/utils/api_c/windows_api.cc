@@ -32,6 +32,8 @@
 
 #ifdef _WIN32
 
+#include <windows.h>
+#include <psapi.h>
 #include <codecvt>
 #include <locale>
 #include "api_c.h"
@@ -98,6 +100,151 @@ err:
   return -1;
 }
 
+int MappedFile::Map(const std::string &path, MapMode mode, bool populate) {
+  if (Unmap() != 0) {
+    return -1;
+  }
+
+  bool read_only = mode == MapMode::ReadOnly;
+  HANDLE h = CreateFile(
+      path.c_str(), read_only ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE,
+      FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL, nullptr);
+
+  if (h == INVALID_HANDLE_VALUE) {
+    std::cerr << "INVALID_HANDLE_VALUE occurs\nError message: "
+              << GetLastError() << std::endl;
+    return -1;
+  }
+
+  LARGE_INTEGER file_size;
+
+  if (!GetFileSizeEx(h, &file_size)) {
+    std::cerr << "Unable to get file size: " << GetLastError() << std::endl;
+    CloseHandle(h);
+    return -1;
+  }
+
+  /* empty file cannot be mapped, but is a valid empty range */
+  if (file_size.QuadPart == 0) {
+    CloseHandle(h);
+    return 0;
+  }
+
+  HANDLE mapping =
+      CreateFileMapping(h, nullptr, read_only ? PAGE_READONLY : PAGE_READWRITE,
+                        0, 0, nullptr);
+  CloseHandle(h);
+
+  if (mapping == nullptr) {
+    std::cerr << "Unable to create file mapping: " << GetLastError()
+              << std::endl;
+    return -1;
+  }
+
+  void *addr = MapViewOfFile(
+      mapping, read_only ? FILE_MAP_READ : FILE_MAP_WRITE, 0, 0, 0);
+
+  if (addr == nullptr) {
+    std::cerr << "Unable to map file: " << GetLastError() << std::endl;
+    CloseHandle(mapping);
+    return -1;
+  }
+
+  data_ = static_cast<char *>(addr);
+  size_ = static_cast<size_t>(file_size.QuadPart);
+  mapping_ = mapping;
+
+  /* there is no equivalent of MAP_POPULATE, so pages are touched instead */
+  if (populate) {
+    volatile char sum = 0;
+    for (size_t offset = 0; offset < size_; offset += 4 * KIBIBYTE) {
+      sum += data_[offset];
+    }
+  }
+
+  return 0;
+}
+
+int MappedFile::Unmap() {
+  if (data_ == nullptr) {
+    return 0;
+  }
+
+  if (!UnmapViewOfFile(data_)) {
+    std::cerr << "Unable to unmap file: " << GetLastError() << std::endl;
+    return -1;
+  }
+
+  CloseHandle(mapping_);
+  data_ = nullptr;
+  size_ = 0;
+  mapping_ = nullptr;
+
+  return 0;
+}
+
+int ApiC::TruncateFile(const std::string &path, size_t length) {
+  HANDLE h = CreateFile(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                        FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                        OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+  if (h == INVALID_HANDLE_VALUE) {
+    std::cerr << "INVALID_HANDLE_VALUE occurs\nError message: "
+              << GetLastError() << std::endl;
+    return -1;
+  }
+
+  /* mark file as sparse so that setting its size does not allocate it */
+  DWORD nbytes;
+  DeviceIoControl(h, FSCTL_SET_SPARSE, nullptr, 0, nullptr, 0, &nbytes,
+                  nullptr);
+
+  LARGE_INTEGER size;
+  size.QuadPart = static_cast<LONGLONG>(length);
+  BOOL resized = SetFilePointerEx(h, size, nullptr, FILE_BEGIN) &&
+                 SetEndOfFile(h);
+  CloseHandle(h);
+
+  if (!resized) {
+    std::cerr << "Unable to set file size: " << GetLastError() << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+int ApiC::SyncFile(const std::string &path) {
+  HANDLE h = CreateFile(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                        FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+  if (h == INVALID_HANDLE_VALUE) {
+    std::cerr << "INVALID_HANDLE_VALUE occurs\nError message: "
+              << GetLastError() << std::endl;
+    return -1;
+  }
+
+  BOOL flushed = FlushFileBuffers(h);
+  CloseHandle(h);
+
+  if (!flushed) {
+    std::cerr << "Unable to flush file: " << GetLastError() << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+int ApiC::CloneFile(const std::string &src, const std::string &dst) {
+  if (!CopyFile(src.c_str(), dst.c_str(), FALSE)) {
+    std::cerr << "Unable to copy file: " << GetLastError() << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
 int ApiC::GetExecutablePath(std::string &path) {
   char file_path[MAX_PATH + 1] = {0};
   auto count = GetModuleFileName(nullptr, file_path, MAX_PATH);
@@ -133,6 +280,120 @@ long long ApiC::GetFreeSpaceT(const std::string &dir) {
   return total_number_of_free_bytes;
 }
 
+int ApiC::GetDeviceId(const std::string &path, unsigned long long &id) {
+  char volume[MAX_PATH + 1] = {0};
+  DWORD serial = 0;
+
+  if (!GetVolumePathName(path.c_str(), volume, MAX_PATH) ||
+      !GetVolumeInformation(volume, nullptr, 0, &serial, nullptr, nullptr,
+                            nullptr, 0)) {
+    std::cerr << "Unable to get device: " << GetLastError() << std::endl;
+    return -1;
+  }
+
+  id = serial;
+  return 0;
+}
+
+long long ApiC::GetAllocatedSize(const std::string &path) {
+  DWORD high = 0;
+  DWORD low = GetCompressedFileSize(path.c_str(), &high);
+
+  if (low == INVALID_FILE_SIZE && GetLastError() != NO_ERROR) {
+    std::cerr << "Unable to get allocated size: " << GetLastError()
+              << std::endl;
+    return -1;
+  }
+
+  return (static_cast<long long>(high) << 32) | low;
+}
+
+int ApiC::GetFileExtents(const std::string &path,
+                         std::vector<FileExtent> &extents) {
+  std::cerr << "Extent map of " << path << " is not supported on Windows"
+            << std::endl;
+  extents.clear();
+  return -1;
+}
+
+int ApiC::EvictFromCache(const std::string &path) {
+  HANDLE h = CreateFile(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                        FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+  if (h == INVALID_HANDLE_VALUE) {
+    std::cerr << "INVALID_HANDLE_VALUE occurs\nError message: "
+              << GetLastError() << std::endl;
+    return -1;
+  }
+
+  BOOL flushed = FlushFileBuffers(h);
+  CloseHandle(h);
+
+  if (!flushed) {
+    std::cerr << "Unable to flush file: " << GetLastError() << std::endl;
+    return -1;
+  }
+
+  /* opening file without buffering purges its pages from system cache */
+  h = CreateFile(path.c_str(), GENERIC_READ,
+                 FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                 FILE_FLAG_NO_BUFFERING, nullptr);
+
+  if (h == INVALID_HANDLE_VALUE) {
+    std::cerr << "INVALID_HANDLE_VALUE occurs\nError message: "
+              << GetLastError() << std::endl;
+    return -1;
+  }
+
+  CloseHandle(h);
+  return 0;
+}
+
+long long ApiC::GetPageCacheSize() {
+  PERFORMANCE_INFORMATION info;
+
+  if (!GetPerformanceInfo(&info, sizeof(info))) {
+    std::cerr << "Unable to get performance information: " << GetLastError()
+              << std::endl;
+    return -1;
+  }
+
+  return static_cast<long long>(info.SystemCache) * info.PageSize;
+}
+
+int ApiC::GetPageFaults(long long &minor, long long &major) {
+  PROCESS_MEMORY_COUNTERS counters;
+
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                            sizeof(counters))) {
+    std::cerr << "Unable to get process memory information: "
+              << GetLastError() << std::endl;
+    return -1;
+  }
+
+  /* Windows does not distinguish soft and hard faults in this counter */
+  minor = counters.PageFaultCount;
+  major = 0;
+
+  return 0;
+}
+
+int ApiC::GetIoCounters(long long &read_bytes, long long &write_bytes) {
+  IO_COUNTERS counters;
+
+  if (!GetProcessIoCounters(GetCurrentProcess(), &counters)) {
+    std::cerr << "Unable to get process I/O counters: " << GetLastError()
+              << std::endl;
+    return -1;
+  }
+
+  read_bytes = static_cast<long long>(counters.ReadTransferCount);
+  write_bytes = static_cast<long long>(counters.WriteTransferCount);
+
+  return 0;
+}
+
 int ApiC::CreateDirectoryT(const std::string &dir) {
   BOOL ret = CreateDirectory(dir.c_str(), nullptr);
 
@@ -196,4 +457,42 @@ int ApiC::RemoveDirectoryT(const std::string &dir) {
   return 0;
 }
 
+int ApiC::GetNumaNodeCpus(int node, std::vector<unsigned> &cpus) {
+  ULONGLONG mask = 0;
+
+  if (!GetNumaNodeProcessorMask(static_cast<UCHAR>(node), &mask)) {
+    std::cerr << "Unable to get processor mask of NUMA node " << node << ": "
+              << GetLastError() << std::endl;
+    return -1;
+  }
+
+  for (unsigned cpu = 0; cpu < 64; ++cpu) {
+    if (mask & (1ULL << cpu)) {
+      cpus.push_back(cpu);
+    }
+  }
+
+  return 0;
+}
+
+int ApiC::PinThreadToNumaNode(int node) {
+  ULONGLONG mask = 0;
+
+  if (!GetNumaNodeProcessorMask(static_cast<UCHAR>(node), &mask) ||
+      mask == 0) {
+    std::cerr << "Unable to get processor mask of NUMA node " << node << ": "
+              << GetLastError() << std::endl;
+    return -1;
+  }
+
+  if (SetThreadAffinityMask(GetCurrentThread(),
+                            static_cast<DWORD_PTR>(mask)) == 0) {
+    std::cerr << "Unable to pin thread to NUMA node " << node << ": "
+              << GetLastError() << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
 #endif  // !_WIN32
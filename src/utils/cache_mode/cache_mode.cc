@@ -0,0 +1,83 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cache_mode.h"
+#include <fstream>
+#include <iostream>
+#include "api_c/api_c.h"
+
+std::vector<CacheState> CacheMode::states_{CacheState::Warm};
+
+int CacheMode::SetMode(const std::string &mode) {
+  if (mode == "cold") {
+    states_ = {CacheState::Cold};
+  } else if (mode == "warm") {
+    states_ = {CacheState::Warm};
+  } else if (mode == "both") {
+    states_ = {CacheState::Cold, CacheState::Warm};
+  } else {
+    std::cerr << "Invalid cache mode: " << mode
+              << "\nExpected: cold, warm or both" << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+std::string CacheMode::GetName(CacheState state) {
+  return state == CacheState::Cold ? "cold" : "warm";
+}
+
+int CacheMode::Prepare(CacheState state,
+                       const std::vector<std::string> &paths) {
+  for (const auto &path : paths) {
+    if (state == CacheState::Cold) {
+      if (ApiC::EvictFromCache(path) != 0) {
+        return -1;
+      }
+      continue;
+    }
+
+    std::ifstream file{path, std::ios::binary};
+    std::vector<char> buffer(MEBIBYTE);
+
+    if (!file) {
+      std::cerr << "Unable to read file " << path << std::endl;
+      return -1;
+    }
+
+    while (file.read(buffer.data(), buffer.size())) {
+    }
+  }
+
+  return 0;
+}
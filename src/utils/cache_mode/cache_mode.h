@@ -0,0 +1,60 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_CACHE_MODE_CACHE_MODE_H_
+#define PMDK_TESTS_SRC_UTILS_CACHE_MODE_CACHE_MODE_H_
+
+#include <string>
+#include <vector>
+
+enum class CacheState { Cold, Warm };
+
+/*
+ * CacheMode -- holds page cache states selected with --cache-mode option, in
+ * which measurements should be taken, and brings files into given state:
+ * cold files are flushed and evicted from page cache, warm files are read
+ * entirely into it.
+ */
+class CacheMode final {
+ private:
+  static std::vector<CacheState> states_;
+
+ public:
+  static int SetMode(const std::string &mode);
+  static const std::vector<CacheState> &GetStates() {
+    return states_;
+  }
+  static std::string GetName(CacheState state);
+  static int Prepare(CacheState state, const std::vector<std::string> &paths);
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_CACHE_MODE_CACHE_MODE_H_
@@ -40,24 +40,76 @@ int LocalConfiguration::FillConfigFields(pugi::xml_node &&root) {
     return -1;
   }
 
-  test_dir_ = root.child("testDir").text().get();
+  for (pugi::xml_node node : root.children("testDir")) {
+    std::string test_dir = node.text().get();
+    std::string name = node.attribute("name").empty()
+                           ? test_dir
+                           : node.attribute("name").value();
 
-  if (test_dir_.empty() || !api_c_.DirectoryExists(this->test_dir_)) {
-    std::cerr << "Directory does not exist. Please change " << this->test_dir_
-              << " field." << std::endl;
-    return -1;
+    for (const auto &configured : test_dirs_) {
+      if (configured.name == name) {
+        std::cerr << "Duplicated test directory name: " << name << std::endl;
+        return -1;
+      }
+    }
+
+    if (test_dir.empty() || !api_c_.DirectoryExists(test_dir)) {
+      std::cerr << "Directory does not exist. Please change " << test_dir
+                << " field." << std::endl;
+      return -1;
+    }
+
+    test_dir += SEPARATOR + "pmdk_tests";
+
+    if (api_c_.CreateDirectoryT(test_dir) != 0) {
+      return -1;
+    }
+
+    int numa_node = node.attribute("numaNode").as_int(NUMA_NODE_UNKNOWN);
+    test_dirs_.push_back({name, test_dir + SEPARATOR, numa_node});
   }
 
-  if (api_c_.CreateDirectoryT((test_dir_ + SEPARATOR + "pmdk_tests").c_str()) !=
-      0) {
+  if (test_dirs_.empty()) {
+    std::cerr << "Cannot find 'testDir' node" << std::endl;
     return -1;
   }
 
-  test_dir_ += SEPARATOR + "pmdk_tests" + SEPARATOR;
-
   return 0;
 }
 
 std::string LocalConfiguration::GetTestDir() {
-  return this->test_dir_;
+  if (test_dirs_.empty()) {
+    return "";
+  }
+
+  return test_dirs_.at(current_).path;
+}
+
+int LocalConfiguration::SelectTestDir(const std::string &name) {
+  for (size_t i = 0; i < test_dirs_.size(); ++i) {
+    if (test_dirs_[i].name == name) {
+      current_ = i;
+      return 0;
+    }
+  }
+
+  std::cerr << "Test directory named " << name
+            << " is not defined in config.xml" << std::endl;
+  return -1;
+}
+
+/*
+ * SetWorker -- moves all test directories into subdirectories of given
+ * worker, so that several binaries may run in parallel.
+ */
+int LocalConfiguration::SetWorker(unsigned worker) {
+  for (auto &test_dir : test_dirs_) {
+    test_dir.path += "worker_" + std::to_string(worker) + SEPARATOR;
+
+    if (api_c_.CreateDirectoryT(test_dir.path) != 0) {
+      return -1;
+    }
+  }
+
+  return 0;
 }
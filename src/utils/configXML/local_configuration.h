@@ -33,19 +33,37 @@
 #ifndef PMDK_TESTS_SRC_UTILS_CONFIGXML_LOCAL_CONFIGURATION_H_
 #define PMDK_TESTS_SRC_UTILS_CONFIGXML_LOCAL_CONFIGURATION_H_
 
+#include <vector>
 #include "api_c/api_c.h"
 #include "pugixml.hpp"
 #include "read_config.h"
 
+const int NUMA_NODE_UNKNOWN = -1;
+
+struct TestDir {
+  std::string name;
+  std::string path;
+  int numa_node;
+};
+
 class LocalConfiguration final : public ReadConfig<LocalConfiguration> {
  private:
   friend class ReadConfig<LocalConfiguration>;
-  std::string test_dir_;
+  std::vector<TestDir> test_dirs_;
+  size_t current_ = 0;
   ApiC api_c_;
   int FillConfigFields(pugi::xml_node &&root);
 
  public:
   std::string GetTestDir();
+  const std::vector<TestDir> &GetTestDirs() const {
+    return test_dirs_;
+  }
+  const TestDir &GetCurrentTestDir() const {
+    return test_dirs_.at(current_);
+  }
+  int SelectTestDir(const std::string &name);
+  int SetWorker(unsigned worker);
 };
 
 #endif  // !PMDK_TESTS_SRC_UTILS_CONFIGXML_LOCAL_CONFIGURATION_H_
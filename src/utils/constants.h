@@ -36,6 +36,7 @@
 #include <libpmemblk.h>
 #include <libpmemlog.h>
 #include <libpmemobj.h>
+#include <array>
 #include <map>
 #include <string>
 
@@ -59,4 +60,23 @@ static const std::map<std::string, size_t> SIZES{
     {"KB", KILOBYTE},  {"MB", MEGABYTE},  {"GB", GIGABYTE},
     {"K", KIBIBYTE},   {"M", MEBIBYTE},   {"G", GIGIBYTE}};
 
+/*
+ * ParseSize -- converts size written as in poolset files (e.g. "20M") to
+ * bytes.
+ */
+static inline size_t ParseSize(std::string size) {
+  std::array<std::string, 9> suffix = {"KiB", "MiB", "GiB", "KB", "MB",
+                                       "GB",  "K",   "M",   "G"};
+  size_t pos;
+  for (const auto &suf : suffix) {
+    if ((pos = size.find(suf)) != std::string::npos) {
+      size.erase(pos);
+
+      return static_cast<size_t>(std::stoul(size)) * SIZES.at(suf);
+    }
+  }
+
+  return static_cast<size_t>(std::stoul(size));
+}
+
 #endif  // !PMDK_TESTS_SRC_UTILS_CONSTANTS_H_
@@ -41,15 +41,20 @@ class Output final {
  private:
   int exit_code_ = 0;
   std::basic_string<T> std_output_;
+  bool timed_out_ = false;
 
  public:
   Output() = default;
-  Output(int exit_code, const std::basic_string<T> &std_output)
-      : exit_code_(exit_code), std_output_(std_output) {
+  Output(int exit_code, const std::basic_string<T> &std_output,
+         bool timed_out = false)
+      : exit_code_(exit_code), std_output_(std_output), timed_out_(timed_out) {
   }
   int GetExitCode() const {
     return exit_code_;
   }
+  bool IsTimedOut() const {
+    return timed_out_;
+  }
   const std::basic_string<T> &GetContent() const {
     return std_output_;
   }
@@ -0,0 +1,253 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pmempool_output.h"
+#include <cctype>
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include "string_utils.h"
+
+namespace {
+enum class LineKind { Other, Title, Field };
+
+/*
+ * ParseLine -- splits line of output into key and value. Title is a key
+ * directly followed by colon and no value.
+ */
+LineKind ParseLine(string_utils::StringView line, std::string &key,
+                   std::string &value) {
+  size_t colon = line.find(':');
+
+  if (colon == string_utils::StringView::npos) {
+    return LineKind::Other;
+  }
+
+  string_utils::StringView key_view = string_utils::Trim(line.substr(0, colon));
+  string_utils::StringView value_view =
+      string_utils::Trim(line.substr(colon + 1));
+
+  if (key_view.empty()) {
+    return LineKind::Other;
+  }
+
+  key.assign(key_view.data(), key_view.size());
+  value.assign(value_view.data(), value_view.size());
+
+  return value.empty() && key_view.end() == line.data() + colon
+             ? LineKind::Title
+             : LineKind::Field;
+}
+
+/* invokes handler for each title and field of output, in single pass */
+template <typename Handler>
+void ForEachLine(const std::string &output, Handler handler) {
+  std::string key, value;
+
+  for (string_utils::StringView line : string_utils::Lines(output)) {
+    LineKind kind = ParseLine(line, key, value);
+    if (kind != LineKind::Other) {
+      handler(kind, key, value);
+    }
+  }
+}
+
+std::string Unquote(const std::string &value) {
+  if (value.size() >= 2 && value.front() == '\'' && value.back() == '\'') {
+    return value.substr(1, value.size() - 2);
+  }
+
+  return value;
+}
+
+bool IsZoneTitle(const std::string &title) {
+  return title.compare(0, 5, "Zone ") == 0 && title.size() > 5 &&
+         isdigit(title[5]);
+}
+
+const std::set<std::string> TOP_LEVEL_TITLES{
+    "Part file",       "POOL Header",     "PMEM OBJ Header", "PMEM BLK Header",
+    "PMEM LOG Header", "Statistics",      "Objects",         "Heap"};
+}
+
+const std::string *ZoneInfo::Find(const std::string &key) const {
+  for (const auto &field : fields) {
+    if (field.first == key) {
+      return &field.second;
+    }
+  }
+
+  return nullptr;
+}
+
+unsigned long long PmempoolOutput::ToNumber(const std::string &value) {
+  /* human readable sizes are followed by exact value, e.g. 2.0M [2097152] */
+  size_t bracket = value.find('[');
+  if (bracket != std::string::npos && bracket + 1 < value.size() &&
+      isdigit(value[bracket + 1])) {
+    return std::strtoull(value.c_str() + bracket + 1, nullptr, 10);
+  }
+
+  return std::strtoull(value.c_str(), nullptr, 0);
+}
+
+int PmempoolOutput::ParseInfo(const std::string &output, PoolInfo &info) {
+  info = PoolInfo{};
+  std::string section;
+  ZoneInfo *zone = nullptr;
+
+  ForEachLine(output, [&](LineKind kind, const std::string &key,
+                          const std::string &value) {
+    if (kind == LineKind::Title) {
+      section = key;
+      info.sections.push_back({key, {}});
+
+      if (IsZoneTitle(key)) {
+        info.zones.emplace_back();
+        info.zones.back().id =
+            static_cast<unsigned>(std::strtoul(key.c_str() + 5, nullptr, 10));
+        zone = &info.zones.back();
+      } else if (TOP_LEVEL_TITLES.count(key) != 0) {
+        zone = nullptr;
+      }
+
+      if (key.compare(0, 6, "Arena ") == 0) {
+        ++info.arenas_count;
+      }
+      return;
+    }
+
+    if (!info.sections.empty()) {
+      info.sections.back().fields.emplace_back(key, value);
+    }
+    if (zone != nullptr) {
+      zone->fields.emplace_back(key, value);
+      return;
+    }
+
+    if (section == "Part file") {
+      if (key == "path") {
+        info.path = value;
+      } else if (key == "size") {
+        info.size = ToNumber(value);
+      }
+    } else if (section == "POOL Header") {
+      if (key == "Signature") {
+        info.signature = value;
+      } else if (key == "Major") {
+        info.major = static_cast<unsigned>(ToNumber(value));
+      } else if (key == "Checksum") {
+        info.checksum_ok = value.find("[OK]") != std::string::npos;
+      }
+    } else if (section == "PMEM OBJ Header") {
+      if (key == "Layout") {
+        info.layout = Unquote(value);
+      } else if (key == "Lanes offset") {
+        info.lanes_offset = ToNumber(value);
+      } else if (key == "Number of lanes") {
+        info.lanes_count = ToNumber(value);
+      } else if (key == "Heap offset") {
+        info.heap_offset = ToNumber(value);
+      } else if (key == "Heap size") {
+        info.heap_size = ToNumber(value);
+      } else if (key == "Root offset") {
+        info.root_offset = ToNumber(value);
+      }
+    } else if (section == "PMEM BLK Header") {
+      if (key == "Block size") {
+        info.block_size = ToNumber(value);
+      } else if (key == "Is zeroed") {
+        info.is_zeroed = value == "true";
+      }
+    } else if (section == "PMEM LOG Header") {
+      if (key == "Start offset") {
+        info.start_offset = ToNumber(value);
+      } else if (key == "End offset") {
+        info.end_offset = ToNumber(value);
+      } else if (key == "Write offset") {
+        info.write_offset = ToNumber(value);
+      }
+    } else if (section == "Objects") {
+      if (key == "Number of objects") {
+        info.objects_count = ToNumber(value);
+      } else if (key == "Number of bytes") {
+        info.objects_size = ToNumber(value);
+      }
+    } else if (section == "Heap") {
+      if (key == "Number of zones") {
+        info.zones_count = ToNumber(value);
+      } else if (key == "Number of used zones") {
+        info.used_zones_count = ToNumber(value);
+      }
+    }
+  });
+
+  if (info.signature.empty()) {
+    std::cerr << "Pool header not found in pmempool info output" << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+int PmempoolOutput::ParseCreate(const std::string &output, CreateInfo &info) {
+  info = CreateInfo{};
+
+  ForEachLine(output, [&info](LineKind kind, const std::string &key,
+                              const std::string &value) {
+    if (kind != LineKind::Field) {
+      return;
+    }
+
+    if (key == "Creating pool") {
+      info.path = value;
+    } else if (key == "type") {
+      info.type = value;
+    } else if (key == "size") {
+      info.size = ToNumber(value);
+    } else if (key == "mode") {
+      info.mode =
+          static_cast<unsigned>(std::strtoul(value.c_str(), nullptr, 8));
+    } else if (key == "layout") {
+      info.layout = Unquote(value);
+    } else if (key == "bsize") {
+      info.block_size = ToNumber(value);
+    }
+  });
+
+  if (info.path.empty()) {
+    std::cerr << "Pool path not found in pmempool create output" << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_PMEMPOOL_OUTPUT_PMEMPOOL_OUTPUT_H_
+#define PMDK_TESTS_SRC_UTILS_PMEMPOOL_OUTPUT_PMEMPOOL_OUTPUT_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "non_copyable/non_copyable.h"
+
+/* key and value of single "key : value" line of pmempool output */
+using Field = std::pair<std::string, std::string>;
+
+/* titled group of fields of pmempool info output */
+struct InfoSection {
+  std::string title;
+  std::vector<Field> fields;
+};
+
+/*
+ * ZoneInfo -- fields of heap zone, gathered from the zone section and all
+ * sections following it up to the next zone or top level section.
+ */
+struct ZoneInfo {
+  unsigned id = 0;
+  std::vector<Field> fields;
+
+  const std::string *Find(const std::string &key) const;
+};
+
+/*
+ * PoolInfo -- typed view of pmempool info output. Fields of pool types other
+ * than the inspected one and statistics not requested with -s option are
+ * left zeroed. All sections are kept for fields not exposed here.
+ */
+struct PoolInfo {
+  /* Part file */
+  std::string path;
+  unsigned long long size = 0;
+
+  /* POOL Header */
+  std::string signature;
+  unsigned major = 0;
+  bool checksum_ok = false;
+
+  /* PMEM OBJ Header */
+  std::string layout;
+  unsigned long long lanes_offset = 0;
+  unsigned long long lanes_count = 0;
+  unsigned long long heap_offset = 0;
+  unsigned long long heap_size = 0;
+  unsigned long long root_offset = 0;
+
+  /* PMEM BLK Header */
+  unsigned long long block_size = 0;
+  bool is_zeroed = false;
+  unsigned arenas_count = 0;
+
+  /* PMEM LOG Header */
+  unsigned long long start_offset = 0;
+  unsigned long long end_offset = 0;
+  unsigned long long write_offset = 0;
+
+  /* statistics */
+  unsigned long long objects_count = 0;
+  unsigned long long objects_size = 0;
+  unsigned long long zones_count = 0;
+  unsigned long long used_zones_count = 0;
+  std::vector<ZoneInfo> zones;
+
+  std::vector<InfoSection> sections;
+};
+
+/* typed view of pmempool create output with verbose option */
+struct CreateInfo {
+  std::string path;
+  std::string type;
+  unsigned long long size = 0;
+  unsigned mode = 0;
+  std::string layout;
+  unsigned long long block_size = 0;
+};
+
+/*
+ * PmempoolOutput -- single pass parsers of pmempool commands output. Each
+ * line is split into key and value at first colon; lines with a key only are
+ * section titles.
+ */
+class PmempoolOutput final : NonCopyable {
+ public:
+  static unsigned long long ToNumber(const std::string &value);
+  static int ParseInfo(const std::string &output, PoolInfo &info);
+  static int ParseCreate(const std::string &output, CreateInfo &info);
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_PMEMPOOL_OUTPUT_PMEMPOOL_OUTPUT_H_
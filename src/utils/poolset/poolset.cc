@@ -49,6 +49,14 @@ void Poolset::InitializeReplicas(std::initializer_list<replica> &&content) {
   }
 }
 
+void Poolset::InitializeReplicas(
+    const std::vector<std::vector<std::string>> &content) {
+  for (const auto &replica : content) {
+    this->replicas_.emplace_back(replica, path_, replica_counter_);
+    ++replica_counter_;
+  }
+}
+
 std::vector<std::string> Poolset::GetContent() const {
   std::vector<std::string> content;
   for (const auto &replica : replicas_) {
@@ -48,6 +48,7 @@ class Poolset final {
   std::string full_path_ = local_config->GetTestDir() + SEPARATOR + name_;
   std::vector<Replica> replicas_;
   void InitializeReplicas(std::initializer_list<replica> &&content);
+  void InitializeReplicas(const std::vector<std::vector<std::string>> &content);
 
  public:
   Poolset() = default;
@@ -64,6 +65,12 @@ class Poolset final {
     full_path_ = path + SEPARATOR + name;
     InitializeReplicas(std::move(content));
   }
+  Poolset(const std::string &path, const std::string &name,
+          const std::vector<std::vector<std::string>> &content)
+      : path_(path), name_(name) {
+    full_path_ = path + SEPARATOR + name;
+    InitializeReplicas(content);
+  }
 
   const std::string &GetName() const {
     return this->name_;
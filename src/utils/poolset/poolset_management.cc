@@ -31,6 +31,26 @@
  */
 
 #include "poolset_management.h"
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "constants.h"
+
+namespace {
+std::vector<std::string> GetPaths(const std::vector<Part> &parts) {
+  std::vector<std::string> paths;
+
+  for (const auto &part : parts) {
+    paths.emplace_back(part.GetPath());
+  }
+
+  return paths;
+}
+}
 
 bool PoolsetManagement::AllFilesExist(const Poolset &p) {
   for (const auto &part : p.GetParts()) {
@@ -76,13 +96,137 @@ int PoolsetManagement::RemovePoolsetFile(const Poolset &p) {
 }
 
 int PoolsetManagement::RemovePartsFromPoolset(const Poolset &p) {
-  int ret = 0;
-  for (const auto &part : p.GetParts()) {
-    ret |= api_c_.RemoveFile(part.GetPath());
-  }
-  return ret;
+  return api_c_.RemoveFiles(GetPaths(p.GetParts()));
 }
 
 int PoolsetManagement::RemovePart(const Part &p) {
   return api_c_.RemoveFile(p.GetPath());
 }
+
+int PoolsetManagement::RemoveReplica(const Replica &r) {
+  return api_c_.RemoveFiles(GetPaths(r.GetParts()));
+}
+
+int PoolsetManagement::ZeroPart(const Part &p) {
+  long long size = api_c_.GetFileSize(p.GetPath());
+  std::fstream file{p.GetPath(),
+                    std::ios::in | std::ios::out | std::ios::binary};
+
+  if (size < 0 || !file) {
+    std::cerr << "Unable to open part " << p.GetPath() << std::endl;
+    return -1;
+  }
+
+  std::vector<char> zeros(MEBIBYTE, 0);
+  for (long long left = size; left > 0;) {
+    std::streamsize count = static_cast<std::streamsize>(
+        std::min(left, static_cast<long long>(zeros.size())));
+    file.write(zeros.data(), count);
+    left -= count;
+  }
+
+  if (!file.flush()) {
+    std::cerr << "Unable to zero part " << p.GetPath() << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+int PoolsetManagement::AllocateParts(const Poolset &p) {
+  std::vector<size_t> sizes;
+
+  for (const auto &part : p.GetParts()) {
+    sizes.emplace_back(ParseSize(part.GetSize()));
+  }
+
+  return api_c_.AllocateFilesSpace(GetPaths(p.GetParts()), sizes);
+}
+
+int PoolsetManagement::SyncParts(const Poolset &p) {
+  return api_c_.SyncFiles(GetPaths(p.GetParts()));
+}
+
+int PoolsetManagement::CreatePart(const Part &p, PartPolicy policy) {
+  size_t size = ParseSize(p.GetSize());
+
+  switch (policy) {
+    case PartPolicy::Sparse:
+      return api_c_.TruncateFile(p.GetPath(), size);
+    case PartPolicy::Allocate:
+      return api_c_.AllocateFileSpace(p.GetPath(), size);
+    case PartPolicy::Zero:
+      if (api_c_.TruncateFile(p.GetPath(), size) != 0 || ZeroPart(p) != 0) {
+        return -1;
+      }
+      return api_c_.SyncFile(p.GetPath());
+  }
+
+  return -1;
+}
+
+int PoolsetManagement::CreateParts(const Poolset &p, PartPolicy policy,
+                                   CreatePartsReport &report,
+                                   unsigned threads_per_device) {
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+  using std::chrono::steady_clock;
+
+  std::vector<Part> parts = p.GetParts();
+  std::map<unsigned long long, std::vector<size_t>> devices;
+
+  report.parts.assign(parts.size(), PartTiming{});
+  for (size_t i = 0; i < parts.size(); ++i) {
+    report.parts[i].path = parts[i].GetPath();
+    if (api_c_.GetDeviceId(parts[i].GetPath(), report.parts[i].device) != 0) {
+      return -1;
+    }
+    devices[report.parts[i].device].push_back(i);
+  }
+
+  unsigned threads = threads_per_device != 0
+                         ? threads_per_device
+                         : std::max(1u, std::thread::hardware_concurrency());
+  std::vector<std::unique_ptr<std::atomic<size_t>>> next;
+  std::vector<std::thread> workers;
+  auto start = steady_clock::now();
+
+  for (const auto &device : devices) {
+    const std::vector<size_t> *indexes = &device.second;
+    next.emplace_back(new std::atomic<size_t>{0});
+    std::atomic<size_t> *next_index = next.back().get();
+
+    for (size_t i = 0; i < std::min<size_t>(threads, indexes->size()); ++i) {
+      workers.emplace_back([this, &parts, &report, policy, indexes,
+                            next_index]() {
+        size_t index;
+        while ((index = next_index->fetch_add(1)) < indexes->size()) {
+          size_t part = indexes->at(index);
+          auto part_start = steady_clock::now();
+          report.parts[part].result = CreatePart(parts[part], policy);
+          report.parts[part].duration =
+              duration_cast<microseconds>(steady_clock::now() - part_start);
+        }
+      });
+    }
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  report.total = duration_cast<microseconds>(steady_clock::now() - start);
+  report.slowest = microseconds::zero();
+  report.devices = static_cast<unsigned>(devices.size());
+
+  int ret = 0;
+  for (const auto &timing : report.parts) {
+    report.slowest = std::max(report.slowest, timing.duration);
+    if (timing.result != 0) {
+      std::cerr << "Unable to create part " << timing.path << std::endl;
+      ret = -1;
+    }
+  }
+
+  return ret;
+}
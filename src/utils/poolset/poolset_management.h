@@ -33,8 +33,36 @@
 #ifndef PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_MANAGEMENT_H_
 #define PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_MANAGEMENT_H_
 
+#include <chrono>
+#include <ostream>
 #include "poolset.h"
 
+/*
+ * PartPolicy -- how CreateParts materializes parts: Sparse only sets file
+ * size, Allocate reserves all blocks and Zero additionally writes zeros.
+ */
+enum class PartPolicy { Sparse, Allocate, Zero };
+
+static inline void PrintTo(PartPolicy policy, std::ostream *os) {
+  *os << (policy == PartPolicy::Sparse
+              ? "sparse"
+              : policy == PartPolicy::Allocate ? "allocate" : "zero");
+}
+
+struct PartTiming {
+  std::string path;
+  unsigned long long device;
+  std::chrono::microseconds duration;
+  int result;
+};
+
+struct CreatePartsReport {
+  std::vector<PartTiming> parts;
+  std::chrono::microseconds total;
+  std::chrono::microseconds slowest;
+  unsigned devices;
+};
+
 class PoolsetManagement final {
  private:
   ApiC api_c_;
@@ -50,6 +78,22 @@ class PoolsetManagement final {
   int RemovePoolsetFile(const Poolset &p);
   int RemovePartsFromPoolset(const Poolset &p);
   int RemovePart(const Part &p);
+  int RemoveReplica(const Replica &r);
+  int ZeroPart(const Part &p);
+  int CreatePart(const Part &p, PartPolicy policy);
+
+  /*
+   * CreateParts -- creates all parts of poolset concurrently. Parts are
+   * grouped by device and each device is served by its own workers, so slow
+   * device does not delay the others. Number of workers per device 0 means
+   * one per CPU.
+   */
+  int CreateParts(const Poolset &p, PartPolicy policy,
+                  CreatePartsReport &report, unsigned threads_per_device = 0);
+
+  /* operations on all parts of poolset, batched when io_uring is available */
+  int AllocateParts(const Poolset &p);
+  int SyncParts(const Poolset &p);
 };
 
 #endif  // !PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_MANAGEMENT_H_
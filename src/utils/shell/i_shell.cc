@@ -32,12 +32,152 @@
 
 #include "i_shell.h"
 
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+const std::chrono::milliseconds REAP_POLL_INTERVAL{10};
+
+std::mutex running_mutex;
+std::vector<pid_t> running_groups;
+
+void RegisterGroup(pid_t pgid) {
+  std::lock_guard<std::mutex> lock(running_mutex);
+  running_groups.push_back(pgid);
+}
+
+void UnregisterGroup(pid_t pgid) {
+  std::lock_guard<std::mutex> lock(running_mutex);
+  running_groups.erase(
+      std::remove(running_groups.begin(), running_groups.end(), pgid),
+      running_groups.end());
+}
+}  // namespace
+
+int IShell::Execute(const std::string &command, std::string &out_buffer,
+                    bool &timed_out) {
+  int fds[2];
+
+  if (pipe2(fds, O_CLOEXEC) != 0) {
+    throw std::runtime_error("pipe failed");
+  }
+
+  pid_t pid = fork();
+
+  if (pid == -1) {
+    close(fds[0]);
+    close(fds[1]);
+    throw std::runtime_error("fork failed");
+  }
+
+  if (pid == 0) {
+    setpgid(0, 0);
+    dup2(fds[1], STDOUT_FILENO);
+    close(fds[0]);
+    close(fds[1]);
+    execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char *>(nullptr));
+    _exit(127);
+  }
+
+  /* set in both processes to avoid race with kill() below */
+  setpgid(pid, pid);
+  RegisterGroup(pid);
+  close(fds[1]);
+
+  auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(timeout_);
+  char buffer[BUFFER_SIZE];
+  struct pollfd pfd = {fds[0], POLLIN, 0};
+
+  for (;;) {
+    int wait_ms = -1;
+
+    if (timeout_ != 0) {
+      auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+          deadline - std::chrono::steady_clock::now());
+      wait_ms = static_cast<int>(std::max<long long>(left.count(), 0));
+    }
+
+    int ret = poll(&pfd, 1, wait_ms);
+
+    if (ret == -1 && errno == EINTR) {
+      continue;
+    }
+
+    if (ret == 0) {
+      kill(-pid, SIGKILL);
+      timed_out = true;
+      break;
+    }
+
+    ssize_t count = read(fds[0], buffer, sizeof(buffer));
+
+    if (count == -1 && errno == EINTR) {
+      continue;
+    }
+
+    if (count <= 0) {
+      break;
+    }
+
+    out_buffer.append(buffer, static_cast<size_t>(count));
+  }
+
+  close(fds[0]);
+
+  /* command may close its output and keep running, deadline applies here too */
+  int status = 0;
+  for (;;) {
+    int options = timeout_ != 0 && !timed_out ? WNOHANG : 0;
+    pid_t ret = waitpid(pid, &status, options);
+
+    if (ret == -1 && errno == EINTR) {
+      continue;
+    }
+
+    if (ret != 0) {
+      break;
+    }
+
+    if (std::chrono::steady_clock::now() >= deadline) {
+      kill(-pid, SIGKILL);
+      timed_out = true;
+    } else {
+      std::this_thread::sleep_for(REAP_POLL_INTERVAL);
+    }
+  }
+  UnregisterGroup(pid);
+
+  return status;
+}
+
+void IShell::KillRunningCommands() {
+  std::lock_guard<std::mutex> lock(running_mutex);
+  for (pid_t pgid : running_groups) {
+    kill(-pgid, SIGKILL);
+  }
+}
+#else
+void IShell::KillRunningCommands() {
+}
+#endif  // !_WIN32
+
+unsigned IShell::default_timeout_ = 0;
+
 Output<char> IShell::ExecuteCommand(const std::string &cmd) {
 #ifdef _WIN32
   std::string command = "PowerShell -Command " + cmd + " 2>&1";
-#else
-  std::string command = "{ " + cmd + "; } 2>&1";
-#endif  // _WIN32
   std::unique_ptr<FILE, PipeDeleter> pipe(popen(command.c_str(), "r"));
 
   if (!pipe) {
@@ -53,10 +193,21 @@ Output<char> IShell::ExecuteCommand(const std::string &cmd) {
 
   auto s_pipe = pipe.release();
   int exit_code = pclose(s_pipe);
-#ifdef _WIN32
   output_ = Output<char>(exit_code, out_buffer);
 #else
-  output_ = Output<char>(WEXITSTATUS(exit_code), out_buffer);
+  std::string command = "{ " + cmd + "; } 2>&1";
+  std::string out_buffer;
+  bool timed_out = false;
+
+  int status = Execute(command, out_buffer, timed_out);
+
+  if (timed_out) {
+    out_buffer += "\nCommand timed out after " + std::to_string(timeout_) +
+                  " seconds: " + cmd;
+    output_ = Output<char>(-1, out_buffer, true);
+  } else {
+    output_ = Output<char>(WEXITSTATUS(status), out_buffer);
+  }
 #endif  // _WIN32
 
   if (print_log_) {
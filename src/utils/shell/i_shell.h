@@ -57,14 +57,39 @@ struct PipeDeleter {
   }
 };
 
+/*
+ * IShell -- executes shell commands and captures their output. Command which
+ * does not finish within timeout (in seconds, 0 means no timeout) is killed
+ * along with its process group and its output is marked as timed out.
+ * Timeouts are supported only on Linux.
+ */
 class IShell : NonCopyable {
  private:
   Output<char> output_;
   bool print_log_ = false;
+  unsigned timeout_ = default_timeout_;
+  static unsigned default_timeout_;
+
+#ifndef _WIN32
+  int Execute(const std::string &command, std::string &out_buffer,
+              bool &timed_out);
+#endif  // !_WIN32
 
  public:
   IShell(){};
   IShell(bool print_log) : print_log_(print_log){};
+  IShell(bool print_log, unsigned timeout)
+      : print_log_(print_log), timeout_(timeout){};
+
+  void SetTimeout(unsigned timeout) {
+    timeout_ = timeout;
+  }
+
+  static void SetDefaultTimeout(unsigned timeout) {
+    default_timeout_ = timeout;
+  }
+
+  static void KillRunningCommands();
 
   Output<char> GetLastOutput() const {
     return output_;
@@ -33,31 +33,231 @@
 #ifndef PMDK_TESTS_SRC_UTILS_STRING_UTILS_H_
 #define PMDK_TESTS_SRC_UTILS_STRING_UTILS_H_
 
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <map>
+#include <queue>
 #include <string>
 #include <vector>
 
 namespace string_utils {
+/*
+ * BasicStringView -- non-owning view of a range of characters, following
+ * interface of C++17 std::basic_string_view. It is valid as long as viewed
+ * string is neither modified nor destroyed.
+ */
+template <typename T>
+class BasicStringView {
+ private:
+  const T *data_ = nullptr;
+  size_t size_ = 0;
+
+ public:
+  static const size_t npos = static_cast<size_t>(-1);
+
+  BasicStringView() = default;
+  BasicStringView(const T *data, size_t size) : data_(data), size_(size) {
+  }
+  BasicStringView(const T *str)
+      : data_(str), size_(std::char_traits<T>::length(str)) {
+  }
+  BasicStringView(const std::basic_string<T> &str)
+      : data_(str.data()), size_(str.size()) {
+  }
+
+  const T *data() const {
+    return data_;
+  }
+  size_t size() const {
+    return size_;
+  }
+  bool empty() const {
+    return size_ == 0;
+  }
+  const T *begin() const {
+    return data_;
+  }
+  const T *end() const {
+    return data_ + size_;
+  }
+  T operator[](size_t pos) const {
+    return data_[pos];
+  }
+
+  size_t find(T c, size_t pos = 0) const {
+    if (pos >= size_) {
+      return npos;
+    }
+
+    const T *found = std::char_traits<T>::find(data_ + pos, size_ - pos, c);
+    return found == nullptr ? npos : static_cast<size_t>(found - data_);
+  }
+
+  BasicStringView substr(size_t pos, size_t count = npos) const {
+    pos = pos < size_ ? pos : size_;
+    return BasicStringView(data_ + pos,
+                           count < size_ - pos ? count : size_ - pos);
+  }
+
+  explicit operator std::basic_string<T>() const {
+    return std::basic_string<T>(data_, size_);
+  }
+
+  bool operator==(BasicStringView other) const {
+    return size_ == other.size_ &&
+           std::char_traits<T>::compare(data_, other.data_, size_) == 0;
+  }
+  bool operator!=(BasicStringView other) const {
+    return !(*this == other);
+  }
+};
+
+using StringView = BasicStringView<char>;
+
+template <typename T>
+bool IsSpace(T c) {
+  return c == T(' ') || c == T('\t') || c == T('\n') || c == T('\r') ||
+         c == T('\v') || c == T('\f');
+}
+
+template <typename T>
+BasicStringView<T> Trim(BasicStringView<T> view) {
+  size_t begin = 0, end = view.size();
+
+  while (begin < end && IsSpace(view[begin])) {
+    ++begin;
+  }
+  while (end > begin && IsSpace(view[end - 1])) {
+    --end;
+  }
+
+  return view.substr(begin, end - begin);
+}
+
+/*
+ * SplitIterator -- lazily yields views of consecutive parts of text divided
+ * by separator. When skip_trailing is set, empty part following the last
+ * separator is not yielded, so that text ending with newline has no extra
+ * empty line.
+ */
+template <typename T>
+class SplitIterator {
+ private:
+  BasicStringView<T> text_;
+  T separator_ = T();
+  bool skip_trailing_ = false;
+  size_t begin_ = BasicStringView<T>::npos;
+  size_t end_ = BasicStringView<T>::npos;
+
+  void FindEnd() {
+    end_ = text_.find(separator_, begin_);
+    if (end_ == BasicStringView<T>::npos) {
+      end_ = text_.size();
+    }
+  }
+
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = BasicStringView<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const BasicStringView<T> *;
+  using reference = BasicStringView<T>;
+
+  /* end iterator */
+  SplitIterator() = default;
+
+  SplitIterator(BasicStringView<T> text, T separator, bool skip_trailing)
+      : text_(text), separator_(separator), skip_trailing_(skip_trailing) {
+    if (!(skip_trailing_ && text_.empty())) {
+      begin_ = 0;
+      FindEnd();
+    }
+  }
+
+  BasicStringView<T> operator*() const {
+    return text_.substr(begin_, end_ - begin_);
+  }
+
+  SplitIterator &operator++() {
+    if (end_ == text_.size() ||
+        (skip_trailing_ && end_ + 1 == text_.size())) {
+      begin_ = end_ = BasicStringView<T>::npos;
+    } else {
+      begin_ = end_ + 1;
+      FindEnd();
+    }
+
+    return *this;
+  }
+
+  SplitIterator operator++(int) {
+    SplitIterator previous = *this;
+    ++*this;
+    return previous;
+  }
+
+  bool operator==(const SplitIterator &other) const {
+    return begin_ == other.begin_ &&
+           (begin_ == BasicStringView<T>::npos ||
+            text_.data() == other.text_.data());
+  }
+  bool operator!=(const SplitIterator &other) const {
+    return !(*this == other);
+  }
+};
+
+template <typename T>
+class SplitRange {
+ private:
+  SplitIterator<T> begin_;
+
+ public:
+  SplitRange(BasicStringView<T> text, T separator, bool skip_trailing)
+      : begin_(text, separator, skip_trailing) {
+  }
+
+  SplitIterator<T> begin() const {
+    return begin_;
+  }
+  SplitIterator<T> end() const {
+    return SplitIterator<T>();
+  }
+};
+
+/* Split -- lazily iterates over fields of text divided by separator */
+template <typename T>
+SplitRange<T> Split(BasicStringView<T> text, T separator) {
+  return SplitRange<T>(text, separator, false);
+}
+
+template <typename T>
+SplitRange<T> Split(const std::basic_string<T> &text, T separator) {
+  return Split(BasicStringView<T>(text), separator);
+}
+
+/* Lines -- lazily iterates over lines of text, without newline characters */
+template <typename T>
+SplitRange<T> Lines(BasicStringView<T> text) {
+  return SplitRange<T>(text, T('\n'), true);
+}
+
+template <typename T>
+SplitRange<T> Lines(const std::basic_string<T> &text) {
+  return Lines(BasicStringView<T>(text));
+}
+
 template <typename To, typename From>
-std::basic_string<To> Convert(std::basic_string<From> f) {
+std::basic_string<To> Convert(const std::basic_string<From> &f) {
   return std::basic_string<To>{f.begin(), f.end()};
 }
 
 template <typename T, template <typename...> class container = std::vector>
-container<std::basic_string<T>> Tokenize(std::basic_string<T> str) {
-  size_t pos;
+container<std::basic_string<T>> Tokenize(const std::basic_string<T> &str) {
   container<std::basic_string<T>> cont;
 
-  std::basic_string<T> separator = string_utils::Convert<T, char>("\n");
-
-  while ((pos = str.find_first_of(separator, 0)) !=
-         std::basic_string<T>::npos) {
-    cont.emplace_back(str.substr(0, pos));
-    str.erase(0, pos + 1);
-  }
-
-  if (!str.empty()) {
-    cont.emplace_back(str);
+  for (BasicStringView<T> line : Lines(str)) {
+    cont.emplace_back(line.data(), line.size());
   }
 
   return cont;
@@ -68,6 +268,116 @@ bool IsSubstrFound(const std::basic_string<T> &substring,
                    const std::basic_string<T> &string) {
   return std::basic_string<T>::npos != string.find(substring);
 }
+
+/*
+ * MultiMatcher -- Aho-Corasick automaton finding which of many patterns
+ * occur in text, in a single pass over the text.
+ */
+template <typename T>
+class MultiMatcher {
+ private:
+  struct Node {
+    std::map<T, size_t> next;
+    size_t fail = 0;
+    /* nearest node on failure path which ends a pattern */
+    size_t output_link = 0;
+    std::vector<size_t> patterns;
+  };
+
+  std::vector<Node> nodes_{1};
+  size_t patterns_count_ = 0;
+
+  size_t Step(size_t state, T c) const {
+    while (true) {
+      auto it = nodes_[state].next.find(c);
+      if (it != nodes_[state].next.end()) {
+        return it->second;
+      }
+      if (state == 0) {
+        return 0;
+      }
+      state = nodes_[state].fail;
+    }
+  }
+
+ public:
+  explicit MultiMatcher(const std::vector<std::basic_string<T>> &patterns)
+      : patterns_count_(patterns.size()) {
+    for (size_t i = 0; i < patterns.size(); ++i) {
+      size_t state = 0;
+
+      for (T c : patterns[i]) {
+        auto it = nodes_[state].next.find(c);
+        if (it == nodes_[state].next.end()) {
+          nodes_[state].next[c] = nodes_.size();
+          state = nodes_.size();
+          nodes_.emplace_back();
+        } else {
+          state = it->second;
+        }
+      }
+      nodes_[state].patterns.push_back(i);
+    }
+
+    /* failure links are computed in breadth-first order */
+    std::queue<size_t> queue;
+    for (const auto &edge : nodes_[0].next) {
+      queue.push(edge.second);
+    }
+
+    while (!queue.empty()) {
+      size_t state = queue.front();
+      queue.pop();
+
+      for (const auto &edge : nodes_[state].next) {
+        size_t child = edge.second;
+        size_t fail = state == 0 ? 0 : Step(nodes_[state].fail, edge.first);
+
+        nodes_[child].fail = fail;
+        nodes_[child].output_link = nodes_[nodes_[child].fail].patterns.empty()
+                                        ? nodes_[nodes_[child].fail].output_link
+                                        : nodes_[child].fail;
+        queue.push(child);
+      }
+    }
+  }
+
+  /* Match -- returns flags telling which patterns were found in text */
+  std::vector<bool> Match(BasicStringView<T> text) const {
+    std::vector<bool> found(patterns_count_, false);
+    std::vector<bool> visited(nodes_.size(), false);
+    size_t state = 0;
+
+    for (size_t pattern : nodes_[0].patterns) {
+      found[pattern] = true;
+    }
+
+    for (T c : text) {
+      state = Step(state, c);
+
+      /* patterns of node and its output path are reported only once */
+      for (size_t node = state; node != 0 && !visited[node];
+           node = nodes_[node].output_link) {
+        visited[node] = true;
+        for (size_t pattern : nodes_[node].patterns) {
+          found[pattern] = true;
+        }
+      }
+    }
+
+    return found;
+  }
+
+  bool MatchAll(BasicStringView<T> text) const {
+    for (bool found : Match(text)) {
+      if (!found) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+};
 }  // namespace string_utils
 
 #endif  // !PMDK_TESTS_SRC_UTILS_STRING_UTILS_H_
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "event_stream.h"
+#include <chrono>
+#include <iostream>
+
+namespace {
+std::string Escape(const std::string &str) {
+  std::string escaped;
+
+  for (char c : str) {
+    switch (c) {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      case '\t':
+        escaped += "\\t";
+        break;
+      default:
+        escaped += c;
+    }
+  }
+
+  return escaped;
+}
+
+std::string GetFullName(const ::testing::TestInfo &test_info) {
+  return std::string(test_info.test_case_name()) + "." + test_info.name();
+}
+
+long long GetTimestamp() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+}  // namespace
+
+EventStream::~EventStream() {
+  if (file_ != nullptr) {
+    fclose(file_);
+  }
+}
+
+int EventStream::Open(const std::string &path) {
+  file_ = fopen(path.c_str(), "a");
+
+  if (file_ == nullptr) {
+    std::cerr << "Unable to open events file: " << path << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+void EventStream::Write(const std::string &event) {
+  if (file_ == nullptr) {
+    return;
+  }
+
+  fputs(event.c_str(), file_);
+  fputc('\n', file_);
+  fflush(file_);
+}
+
+void EventStream::TestStarted(const std::string &name) {
+  Write("{\"event\": \"start\", \"test\": \"" + Escape(name) +
+        "\", \"timestamp\": " + std::to_string(GetTimestamp()) + "}");
+}
+
+void EventStream::TestEnded(const std::string &name, const std::string &result,
+                            long long duration_ms) {
+  Write("{\"event\": \"end\", \"test\": \"" + Escape(name) +
+        "\", \"result\": \"" + result +
+        "\", \"duration_ms\": " + std::to_string(duration_ms) +
+        ", \"timestamp\": " + std::to_string(GetTimestamp()) + "}");
+}
+
+void EventStream::OnTestStart(const ::testing::TestInfo &test_info) {
+  TestStarted(GetFullName(test_info));
+}
+
+void EventStream::OnTestEnd(const ::testing::TestInfo &test_info) {
+  const ::testing::TestResult &result = *test_info.result();
+  TestEnded(GetFullName(test_info), result.Passed() ? "passed" : "failed",
+            result.elapsed_time());
+}
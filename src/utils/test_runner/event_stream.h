@@ -0,0 +1,68 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_TEST_RUNNER_EVENT_STREAM_H_
+#define PMDK_TESTS_SRC_UTILS_TEST_RUNNER_EVENT_STREAM_H_
+
+#include <cstdio>
+#include <string>
+#include "gtest/gtest.h"
+
+/*
+ * EventStream -- streams structured per-test events to a side-channel file,
+ * one JSON object per line. Every event is flushed as soon as it is written,
+ * so consumer can follow the stream while tests are running and nothing is
+ * lost when the binary terminates prematurely.
+ */
+class EventStream final : public ::testing::EmptyTestEventListener {
+ private:
+  FILE *file_ = nullptr;
+
+  void Write(const std::string &event);
+
+ public:
+  EventStream() = default;
+  EventStream(const EventStream &) = delete;
+  EventStream &operator=(const EventStream &) = delete;
+  ~EventStream();
+
+  int Open(const std::string &path);
+
+  void TestStarted(const std::string &name);
+  void TestEnded(const std::string &name, const std::string &result,
+                 long long duration_ms);
+
+  void OnTestStart(const ::testing::TestInfo &test_info) override;
+  void OnTestEnd(const ::testing::TestInfo &test_info) override;
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_TEST_RUNNER_EVENT_STREAM_H_
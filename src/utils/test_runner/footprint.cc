@@ -0,0 +1,103 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "footprint.h"
+#include <algorithm>
+#include <utility>
+
+namespace {
+std::vector<std::pair<std::string, Footprint::Estimator>> &GetRegistry() {
+  static std::vector<std::pair<std::string, Footprint::Estimator>> registry;
+  return registry;
+}
+
+size_t GetParamIndex(const std::string &test) {
+  size_t slash = test.rfind('/');
+
+  if (slash == std::string::npos || slash < test.find('.') ||
+      slash + 1 == test.size() ||
+      !std::all_of(test.begin() + slash + 1, test.end(),
+                   [](char c) { return c >= '0' && c <= '9'; })) {
+    return 0;
+  }
+
+  return std::stoul(test.substr(slash + 1));
+}
+
+/* checks whether test name equals prefix or continues it with '.' or '/' */
+bool HasPrefix(const std::string &test, const std::string &prefix) {
+  return test.compare(0, prefix.size(), prefix) == 0 &&
+         (test.size() == prefix.size() || test[prefix.size()] == '.' ||
+          test[prefix.size()] == '/');
+}
+}  // namespace
+
+Footprint::Footprint(const std::string &prefix, Estimator estimator) {
+  GetRegistry().emplace_back(prefix, std::move(estimator));
+}
+
+Footprint::Footprint(const std::string &prefix, unsigned long long size)
+    : Footprint(prefix, [size](size_t) { return size; }) {
+}
+
+unsigned long long Footprint::Get(const std::string &test) {
+  const std::pair<std::string, Estimator> *match = nullptr;
+
+  for (const auto &entry : GetRegistry()) {
+    if (HasPrefix(test, entry.first) &&
+        (match == nullptr || entry.first.size() > match->first.size())) {
+      match = &entry;
+    }
+  }
+
+  if (match == nullptr) {
+    return EXCLUSIVE;
+  }
+
+  return match->second(GetParamIndex(test));
+}
+
+void Footprint::List(const std::vector<std::string> &tests,
+                     std::ostream &out) {
+  for (const auto &test : tests) {
+    unsigned long long footprint = Get(test);
+    out << test << " ";
+
+    if (footprint == EXCLUSIVE) {
+      out << "exclusive";
+    } else {
+      out << footprint;
+    }
+
+    out << std::endl;
+  }
+}
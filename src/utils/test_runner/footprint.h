@@ -0,0 +1,74 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_TEST_RUNNER_FOOTPRINT_H_
+#define PMDK_TESTS_SRC_UTILS_TEST_RUNNER_FOOTPRINT_H_
+
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+/*
+ * Footprint -- declares how much space tests take in test directory, so that
+ * tests run in parallel can be admitted only while their summed footprint
+ * fits in free space. Footprint is registered for tests whose full name
+ * starts with given prefix of name components ("Instantiation",
+ * "Instantiation/TestCase" or "TestCase.Test"), with function of parameter
+ * index ("/N" suffix of test name, 0 for tests without parameters). The
+ * longest matching prefix wins, so single test can override footprint of
+ * its test case. Functions are called only when footprints are listed,
+ * after test directory is selected. Tests without registered footprint are
+ * treated as exclusive, as nothing is known about space they take.
+ */
+class Footprint final {
+ public:
+  using Estimator = std::function<unsigned long long(size_t index)>;
+
+  /* test needs whole test directory and has to run alone */
+  static const unsigned long long EXCLUSIVE =
+      std::numeric_limits<unsigned long long>::max();
+
+  Footprint(const std::string &prefix, Estimator estimator);
+  Footprint(const std::string &prefix, unsigned long long size);
+
+  static unsigned long long Get(const std::string &test);
+
+  /*
+   * List -- prints footprint in bytes (or "exclusive") of each test in
+   * "<test> <footprint>" lines.
+   */
+  static void List(const std::vector<std::string> &tests, std::ostream &out);
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_TEST_RUNNER_FOOTPRINT_H_
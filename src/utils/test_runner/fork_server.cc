@@ -0,0 +1,344 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef __linux__
+
+#include "fork_server.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include "configXML/local_configuration.h"
+#include "gtest/gtest.h"
+#include "string_utils.h"
+
+extern std::unique_ptr<LocalConfiguration> local_config;
+
+namespace {
+const std::string TEST_PLANNED = "P";
+const std::string TEST_STARTED = "S";
+const std::string TEST_ENDED = "E";
+
+struct TestResult {
+  std::string name;
+  bool passed;
+  long long time_ms;
+};
+
+std::string GetFullName(const ::testing::TestInfo &test_info) {
+  return std::string(test_info.test_case_name()) + "." + test_info.name();
+}
+
+/*
+ * PipeReporter -- sends order in which tests are going to run (which differs
+ * from requested one with --gtest_shuffle), and start and end of each test
+ * to the parent. Every record is written with a single write() call, so
+ * nothing is lost when the child is killed.
+ */
+class PipeReporter final : public ::testing::EmptyTestEventListener {
+ private:
+  int fd_;
+
+  void Send(const std::string &record) {
+    const char *buf = record.c_str();
+    size_t left = record.size();
+
+    while (left > 0) {
+      ssize_t ret = write(fd_, buf, left);
+      if (ret == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return;
+      }
+      buf += ret;
+      left -= static_cast<size_t>(ret);
+    }
+  }
+
+ public:
+  explicit PipeReporter(int fd) : fd_(fd) {
+  }
+
+  void OnTestIterationStart(const ::testing::UnitTest &unit_test,
+                            int) override {
+    std::string records;
+
+    for (int i = 0; i < unit_test.total_test_case_count(); ++i) {
+      const ::testing::TestCase &test_case = *unit_test.GetTestCase(i);
+
+      for (int j = 0; j < test_case.total_test_count(); ++j) {
+        const ::testing::TestInfo &test_info = *test_case.GetTestInfo(j);
+
+        if (test_info.should_run()) {
+          records += TEST_PLANNED + "\t" + GetFullName(test_info) + "\n";
+        }
+      }
+    }
+
+    Send(records);
+  }
+
+  void OnTestStart(const ::testing::TestInfo &test_info) override {
+    Send(TEST_STARTED + "\t" + GetFullName(test_info) + "\n");
+  }
+
+  void OnTestEnd(const ::testing::TestInfo &test_info) override {
+    Send(TEST_ENDED + "\t" + GetFullName(test_info) + "\t" +
+         (test_info.result()->Passed() ? "1" : "0") + "\t" +
+         std::to_string(test_info.result()->elapsed_time()) + "\n");
+  }
+};
+
+std::string ReadAll(int fd) {
+  std::string content;
+  char buffer[4096];
+  ssize_t count;
+
+  while ((count = read(fd, buffer, sizeof(buffer))) != 0) {
+    if (count == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      std::cerr << "Unable to read from pipe: " << strerror(errno)
+                << std::endl;
+      break;
+    }
+    content.append(buffer, static_cast<size_t>(count));
+  }
+
+  return content;
+}
+
+std::string DescribeStatus(int status) {
+  if (WIFSIGNALED(status)) {
+    return "signal " + std::to_string(WTERMSIG(status));
+  }
+
+  return "exit code " + std::to_string(WEXITSTATUS(status));
+}
+}  // namespace
+
+void ForkServer::RunBatch(std::deque<std::string> &pending) {
+  const size_t count =
+      std::min(pending.size(), static_cast<size_t>(batch_size_));
+  int fds[2];
+
+  if (pipe2(fds, O_CLOEXEC) != 0) {
+    throw std::runtime_error("pipe failed: " + std::string(strerror(errno)));
+  }
+
+  /* report left by previous child would be taken for this one's */
+  if (!xml_path_.empty() && ApiC::RegularFileExists(xml_path_)) {
+    ApiC::RemoveFile(xml_path_);
+  }
+
+  std::cout.flush();
+  fflush(stdout);
+
+  pid_t pid = fork();
+
+  if (pid == -1) {
+    throw std::runtime_error("fork failed: " + std::string(strerror(errno)));
+  }
+
+  if (pid == 0) {
+    close(fds[0]);
+
+    std::string filter;
+    for (size_t i = 0; i < count; ++i) {
+      filter += pending[i] + ":";
+    }
+    ::testing::GTEST_FLAG(filter) = filter;
+
+    /* tests were already selected for this shard */
+    unsetenv("GTEST_TOTAL_SHARDS");
+    unsetenv("GTEST_SHARD_INDEX");
+
+    ::testing::UnitTest::GetInstance()->listeners().Append(
+        new PipeReporter(fds[1]));
+
+    int ret = RUN_ALL_TESTS();
+    std::cout.flush();
+    fflush(stdout);
+    _exit(ret);
+  }
+
+  close(fds[1]);
+  const std::string records = ReadAll(fds[0]);
+  close(fds[0]);
+
+  int status = 0;
+  while (waitpid(pid, &status, 0) == -1 && errno == EINTR) {
+  }
+
+  std::vector<std::string> planned;
+  std::vector<TestResult> ended;
+  std::set<std::string> finished;
+  std::string running;
+
+  for (string_utils::StringView record : string_utils::Lines(records)) {
+    std::vector<string_utils::StringView> fields;
+    for (string_utils::StringView field : string_utils::Split(record, '\t')) {
+      fields.push_back(field);
+    }
+
+    if (fields.size() == 2 && fields[0] == TEST_PLANNED) {
+      planned.emplace_back(fields[1]);
+    } else if (fields.size() == 2 && fields[0] == TEST_STARTED) {
+      running = std::string(fields[1]);
+    } else if (fields.size() == 4 && fields[0] == TEST_ENDED) {
+      if (fields[2] != "1") {
+        failed_.emplace_back(fields[1]);
+      }
+      ended.push_back({std::string(fields[1]), fields[2] == "1",
+                       std::stoll(std::string(fields[3]))});
+      finished.emplace(fields[1]);
+      running.clear();
+    }
+  }
+
+  /*
+   * child terminated between tests or before running any of them, blame the
+   * first test it did not finish in order it reported
+   */
+  if (running.empty() && finished.size() < count &&
+      (WIFSIGNALED(status) || finished.empty())) {
+    running = pending.front();
+
+    for (const auto &test : planned) {
+      if (finished.count(test) == 0) {
+        running = test;
+        break;
+      }
+    }
+  }
+
+  if (!running.empty()) {
+    crashed_.emplace_back(running + " (" + DescribeStatus(status) + ")");
+    finished.emplace(running);
+
+    std::cout << "[ CRASHED  ] " << crashed_.back() << std::endl;
+    if (events_ != nullptr) {
+      events_->TestEnded(running, "crashed", 0);
+    }
+
+    /* crashed test might have used any of test directories */
+    for (const auto &test_dir : local_config->GetTestDirs()) {
+      if (ApiC::DirectoryExists(test_dir.path)) {
+        ApiC::CleanDirectory(test_dir.path);
+      }
+    }
+  }
+
+  if (!xml_path_.empty()) {
+    /* report is written at the end of iteration, so not by crashed child */
+    if (ApiC::RegularFileExists(xml_path_)) {
+      xml_report_.Append(xml_path_);
+      ApiC::RemoveFile(xml_path_);
+    } else {
+      for (const auto &result : ended) {
+        xml_report_.AddTest(result.name, result.time_ms,
+                            result.passed ? "" : "Failed");
+      }
+    }
+
+    if (!running.empty()) {
+      xml_report_.AddTest(running, 0,
+                          "Crashed (" + DescribeStatus(status) + ")");
+    }
+  }
+
+  /* tests of the batch which did not run are resumed in the next child */
+  std::vector<std::string> remaining;
+  for (size_t i = 0; i < count; ++i) {
+    if (finished.count(pending[i]) == 0) {
+      remaining.emplace_back(pending[i]);
+    }
+  }
+
+  pending.erase(pending.begin(), pending.begin() + count);
+  pending.insert(pending.begin(), remaining.begin(), remaining.end());
+}
+
+void ForkServer::PrintSummary(size_t tests_count,
+                              unsigned children_count) const {
+  size_t passed = tests_count - failed_.size() - crashed_.size();
+
+  std::cout << "[==========] " << tests_count << " tests ran in "
+            << children_count << " child processes." << std::endl;
+  std::cout << "[  PASSED  ] " << passed << " tests." << std::endl;
+
+  if (!failed_.empty()) {
+    std::cout << "[  FAILED  ] " << failed_.size()
+              << " tests, listed below:" << std::endl;
+    for (const auto &test : failed_) {
+      std::cout << "[  FAILED  ] " << test << std::endl;
+    }
+  }
+
+  if (!crashed_.empty()) {
+    std::cout << "[ CRASHED  ] " << crashed_.size()
+              << " tests, listed below:" << std::endl;
+    for (const auto &test : crashed_) {
+      std::cout << "[ CRASHED  ] " << test << std::endl;
+    }
+  }
+}
+
+int ForkServer::Run(const std::vector<std::string> &tests) {
+  unsigned children_count = 0;
+  std::deque<std::string> pending(tests.begin(), tests.end());
+
+  while (!pending.empty()) {
+    RunBatch(pending);
+    ++children_count;
+  }
+
+  PrintSummary(tests.size(), children_count);
+
+  if (!xml_path_.empty() && xml_report_.Save(xml_path_) != 0) {
+    return -1;
+  }
+
+  return failed_.empty() && crashed_.empty() ? 0 : 1;
+}
+
+#endif  // __linux__
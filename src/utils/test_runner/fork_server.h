@@ -0,0 +1,73 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_TEST_RUNNER_FORK_SERVER_H_
+#define PMDK_TESTS_SRC_UTILS_TEST_RUNNER_FORK_SERVER_H_
+
+#include <deque>
+#include <string>
+#include <vector>
+#include "event_stream.h"
+#include "non_copyable/non_copyable.h"
+#include "xml_report.h"
+
+/*
+ * ForkServer -- runs tests in child processes forked from already
+ * initialized parent. Each child runs a batch of tests and reports their
+ * results back over a pipe. When child terminates prematurely, test which
+ * was running is marked as crashed and tests of the batch which did not run
+ * yet are resumed in a new child. XML reports written by children to the
+ * path requested with --gtest_output are merged into a single report, to
+ * which tests of terminated children are added from their pipe records.
+ */
+class ForkServer final : NonCopyable {
+ private:
+  unsigned batch_size_;
+  EventStream *events_;
+  std::string xml_path_;
+  XmlReport xml_report_;
+  std::vector<std::string> failed_;
+  std::vector<std::string> crashed_;
+
+  void RunBatch(std::deque<std::string> &pending);
+  void PrintSummary(size_t tests_count, unsigned children_count) const;
+
+ public:
+  ForkServer(unsigned batch_size, EventStream *events,
+             const std::string &xml_path)
+      : batch_size_(batch_size), events_(events), xml_path_(xml_path) {
+  }
+
+  int Run(const std::vector<std::string> &tests);
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_TEST_RUNNER_FORK_SERVER_H_
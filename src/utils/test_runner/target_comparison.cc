@@ -0,0 +1,298 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "target_comparison.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include "configXML/read_config.h"
+#include "pugixml.hpp"
+
+namespace {
+const std::string RESULTS_DIR = "target_results";
+const std::string NOT_RUN = "-";
+
+std::string Quote(const std::string &arg) {
+#ifdef _WIN32
+  std::string quoted = "\"";
+  for (char c : arg) {
+    if (c == '"') {
+      quoted += '\\';
+    }
+    quoted += c;
+  }
+  return quoted + "\"";
+#else
+  std::string quoted = "'";
+  for (char c : arg) {
+    if (c == '\'') {
+      quoted += "'\\''";
+    } else {
+      quoted += c;
+    }
+  }
+  return quoted + "'";
+#endif  // _WIN32
+}
+
+/* name of XML report generated by gtest when directory is given */
+std::string GetBinaryName(const std::string &binary) {
+  const std::string EXTENSION = ".exe";
+  std::string name = binary.substr(binary.find_last_of("/\\") + 1);
+
+  if (name.size() > EXTENSION.size() &&
+      name.compare(name.size() - EXTENSION.size(), EXTENSION.size(),
+                   EXTENSION) == 0) {
+    name.erase(name.size() - EXTENSION.size());
+  }
+
+  return name;
+}
+
+bool IsTestcaseAttribute(const std::string &name) {
+  static const std::vector<std::string> attributes{
+      "name",        "status",     "result", "time", "timestamp", "classname",
+      "value_param", "type_param", "file",   "line"};
+
+  return std::find(attributes.begin(), attributes.end(), name) !=
+         attributes.end();
+}
+
+std::string ToCsvField(const std::string &value) {
+  if (value.find_first_of(",\"") == std::string::npos) {
+    return value;
+  }
+
+  std::string field = "\"";
+  for (char c : value) {
+    if (c == '"') {
+      field += '"';
+    }
+    field += c;
+  }
+  return field + "\"";
+}
+}  // namespace
+
+int TargetComparison::Run(const std::string &binary,
+                          const std::vector<std::string> &args) {
+  if (ApiC::GetExecutablePath(results_dir_) != 0) {
+    std::cerr << "Cannot get path to executable" << std::endl;
+    return -1;
+  }
+
+  results_dir_ += RESULTS_DIR;
+  if (!ApiC::DirectoryExists(results_dir_) &&
+      ApiC::CreateDirectoryT(results_dir_) != 0) {
+    return -1;
+  }
+  results_dir_ += SEPARATOR;
+  binary_name_ = GetBinaryName(binary);
+
+  std::string command = Quote(binary);
+  for (const auto &arg : args) {
+    command += " " + Quote(arg);
+  }
+
+  int ret = 0;
+  for (size_t i = 0; i < targets_.size(); ++i) {
+    if (RunTarget(i, command) != 0) {
+      ret = 1;
+    }
+  }
+
+  PrintReport();
+
+  if (WriteCsv(results_dir_ + "report.csv") != 0) {
+    return -1;
+  }
+
+  return ret;
+}
+
+int TargetComparison::RunTarget(size_t index, const std::string &command) {
+  const std::string &target = targets_[index];
+  std::string report_dir = results_dir_ + target;
+
+  if (ApiC::DirectoryExists(report_dir)) {
+    ApiC::CleanDirectory(report_dir);
+  } else if (ApiC::CreateDirectoryT(report_dir) != 0) {
+    return -1;
+  }
+  report_dir += SEPARATOR;
+
+  std::string target_command = command + " " + Quote("--target=" + target) +
+                               " " + Quote("--gtest_output=xml:" + report_dir);
+#ifdef _WIN32
+  /* cmd.exe strips outer quotes of the whole command line */
+  target_command = "\"" + target_command + "\"";
+#endif  // _WIN32
+
+  std::cout << "[ TARGET   ] " << target << std::endl;
+  int ret = std::system(target_command.c_str());
+
+  CollectResults(index, report_dir);
+
+  if (ret != 0) {
+    std::cout << "[ TARGET   ] " << target << " finished with failures"
+              << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+void TargetComparison::CollectResults(size_t index,
+                                      const std::string &report_dir) {
+  /* in fork server mode reports of children are merged into this one */
+  const std::string path = report_dir + binary_name_ + ".xml";
+  pugi::xml_document report;
+
+  if (!report.load_file(path.c_str())) {
+    std::cerr << "Cannot parse test report " << path << std::endl;
+    return;
+  }
+
+  for (pugi::xml_node suite :
+       report.child("testsuites").children("testsuite")) {
+    for (pugi::xml_node test : suite.children("testcase")) {
+      if (std::string(test.attribute("status").value()) != "run") {
+        continue;
+      }
+
+      std::string name = std::string(test.attribute("classname").value()) +
+                         "." + test.attribute("name").value();
+      std::string time_ms = std::to_string(
+          static_cast<long long>(test.attribute("time").as_double() * 1000));
+
+      if (test.child("failure")) {
+        time_ms += " (failed)";
+      }
+      AddValue(name + " [time_ms]", index, time_ms);
+
+      for (pugi::xml_attribute attribute : test.attributes()) {
+        if (!IsTestcaseAttribute(attribute.name())) {
+          AddValue(name + " [" + attribute.name() + "]", index,
+                   attribute.value());
+        }
+      }
+
+      for (pugi::xml_node property :
+           test.child("properties").children("property")) {
+        AddValue(name + " [" + property.attribute("name").value() + "]",
+                 index, property.attribute("value").value());
+      }
+    }
+  }
+}
+
+void TargetComparison::AddValue(const std::string &row, size_t index,
+                                const std::string &value) {
+  auto it = values_.find(row);
+
+  if (it == values_.end()) {
+    rows_.emplace_back(row);
+    it = values_
+             .emplace(row, std::vector<std::string>(targets_.size(), NOT_RUN))
+             .first;
+  }
+
+  it->second[index] = value;
+}
+
+void TargetComparison::PrintReport() const {
+  const std::string HEADER = "Test [value]";
+  std::vector<size_t> widths{HEADER.size()};
+
+  for (const auto &target : targets_) {
+    widths.emplace_back(target.size());
+  }
+
+  for (const auto &row : rows_) {
+    widths[0] = std::max(widths[0], row.size());
+    const auto &values = values_.at(row);
+    for (size_t i = 0; i < values.size(); ++i) {
+      widths[i + 1] = std::max(widths[i + 1], values[i].size());
+    }
+  }
+
+  std::cout << "[==========] Comparison of " << targets_.size()
+            << " targets:" << std::endl;
+
+  std::cout << std::left << std::setw(widths[0]) << HEADER;
+  for (size_t i = 0; i < targets_.size(); ++i) {
+    std::cout << "  " << std::right << std::setw(widths[i + 1])
+              << targets_[i];
+  }
+  std::cout << std::endl;
+
+  for (const auto &row : rows_) {
+    std::cout << std::left << std::setw(widths[0]) << row;
+    const auto &values = values_.at(row);
+    for (size_t i = 0; i < values.size(); ++i) {
+      std::cout << "  " << std::right << std::setw(widths[i + 1])
+                << values[i];
+    }
+    std::cout << std::endl;
+  }
+  std::cout << std::left;
+}
+
+int TargetComparison::WriteCsv(const std::string &path) const {
+  std::ofstream csv{path};
+
+  if (!csv) {
+    std::cerr << "Cannot create report " << path << std::endl;
+    return -1;
+  }
+
+  csv << "test";
+  for (const auto &target : targets_) {
+    csv << "," << ToCsvField(target);
+  }
+  csv << "\n";
+
+  for (const auto &row : rows_) {
+    csv << ToCsvField(row);
+    for (const auto &value : values_.at(row)) {
+      csv << "," << ToCsvField(value);
+    }
+    csv << "\n";
+  }
+
+  std::cout << "[==========] Comparison report saved to " << path
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_TEST_RUNNER_TARGET_COMPARISON_H_
+#define PMDK_TESTS_SRC_UTILS_TEST_RUNNER_TARGET_COMPARISON_H_
+
+#include <map>
+#include <string>
+#include <vector>
+#include "non_copyable/non_copyable.h"
+
+/*
+ * TargetComparison -- runs selected tests once per named test directory
+ * (storage target) defined in config.xml. Each target is run by a separate
+ * instance of the binary with the target selected before test parameters
+ * are generated. Test durations and recorded properties are collected from
+ * gtest XML reports and printed side by side, keyed by target.
+ */
+class TargetComparison final : NonCopyable {
+ private:
+  std::vector<std::string> targets_;
+  std::string results_dir_;
+  std::string binary_name_;
+  std::vector<std::string> rows_;
+  std::map<std::string, std::vector<std::string>> values_;
+
+  int RunTarget(size_t index, const std::string &command);
+  void CollectResults(size_t index, const std::string &report_dir);
+  void AddValue(const std::string &row, size_t index,
+                const std::string &value);
+  void PrintReport() const;
+  int WriteCsv(const std::string &path) const;
+
+ public:
+  explicit TargetComparison(const std::vector<std::string> &targets)
+      : targets_(targets) {
+  }
+
+  int Run(const std::string &binary, const std::vector<std::string> &args);
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_TEST_RUNNER_TARGET_COMPARISON_H_
@@ -0,0 +1,323 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_runner.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <set>
+#include "api_c/api_c.h"
+#include "cache_mode/cache_mode.h"
+#include "configXML/local_configuration.h"
+#include "event_stream.h"
+#include "footprint.h"
+#include "fork_server.h"
+#include "gtest/gtest.h"
+#include "shell/i_shell.h"
+#include "string_utils.h"
+#include "target_comparison.h"
+#include "test_selection.h"
+#include "watchdog.h"
+#include "xml_report.h"
+
+extern std::unique_ptr<LocalConfiguration> local_config;
+
+namespace {
+bool ParseValue(const std::string &arg, const std::string &option,
+                std::string &value) {
+  if (arg.compare(0, option.size(), option) != 0) {
+    return false;
+  }
+
+  value = arg.substr(option.size());
+  return true;
+}
+
+bool ParseRange(const std::string &range, size_t &begin, size_t &end) {
+  size_t colon = range.find(':');
+
+  if (colon == std::string::npos) {
+    return false;
+  }
+
+  try {
+    begin = std::stoul(range.substr(0, colon));
+    if (colon + 1 != range.size()) {
+      end = std::stoul(range.substr(colon + 1));
+    }
+  } catch (const std::exception &) {
+    return false;
+  }
+
+  return begin <= end;
+}
+
+/* ReadTestNames -- reads full test names listed one per line */
+int ReadTestNames(const std::string &path, std::set<std::string> &names) {
+  std::string content;
+
+  if (ApiC::ReadFile(path, content) != 0) {
+    std::cerr << "Unable to read test names from " << path << std::endl;
+    return -1;
+  }
+
+  for (string_utils::StringView line : string_utils::Lines(content)) {
+    line = string_utils::Trim(line);
+    if (!line.empty()) {
+      names.emplace(line);
+    }
+  }
+
+  return 0;
+}
+
+bool ParseSeconds(const std::string &value, unsigned &seconds) {
+  try {
+    seconds = static_cast<unsigned>(std::stoul(value));
+  } catch (const std::exception &) {
+    std::cerr << "Invalid number of seconds: " << value << std::endl;
+    return false;
+  }
+
+  return true;
+}
+}  // namespace
+
+int TestRunner::ParseTargets(const std::string &value) {
+  const auto &test_dirs = local_config->GetTestDirs();
+
+  if (value == "all") {
+    for (const auto &test_dir : test_dirs) {
+      targets_.emplace_back(test_dir.name);
+    }
+    return 0;
+  }
+
+  size_t begin = 0;
+  while (begin <= value.size()) {
+    size_t end = std::min(value.find(',', begin), value.size());
+    std::string target = value.substr(begin, end - begin);
+
+    if (std::none_of(test_dirs.begin(), test_dirs.end(),
+                     [&target](const TestDir &test_dir) {
+                       return test_dir.name == target;
+                     })) {
+      std::cerr << "Test directory named " << target
+                << " is not defined in config.xml" << std::endl;
+      return -1;
+    }
+
+    targets_.emplace_back(target);
+    begin = end + 1;
+  }
+
+  return 0;
+}
+
+int TestRunner::ParseArguments(int argc, char **argv) {
+  std::string value;
+  binary_ = argv[0];
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+
+    if (ParseValue(arg, "--targets=", value)) {
+      if (ParseTargets(value) != 0) {
+        return -1;
+      }
+      continue;
+    }
+    args_.emplace_back(arg);
+
+    if (arg == "--fork-server") {
+      fork_server_ = true;
+    } else if (ParseValue(arg, "--fork-batch-size=", value)) {
+      try {
+        fork_batch_size_ = static_cast<unsigned>(std::stoul(value));
+      } catch (const std::exception &) {
+        fork_batch_size_ = 0;
+      }
+
+      if (fork_batch_size_ == 0) {
+        std::cerr << "Invalid fork batch size: " << value << std::endl;
+        return -1;
+      }
+    } else if (ParseValue(arg, "--events-file=", value)) {
+      events_file_ = value;
+    } else if (ParseValue(arg, "--test-timeout=", value)) {
+      if (!ParseSeconds(value, test_timeout_)) {
+        return -1;
+      }
+    } else if (ParseValue(arg, "--command-timeout=", value)) {
+      unsigned command_timeout = 0;
+      if (!ParseSeconds(value, command_timeout)) {
+        return -1;
+      }
+      IShell::SetDefaultTimeout(command_timeout);
+    } else if (ParseValue(arg, "--cache-mode=", value)) {
+      if (CacheMode::SetMode(value) != 0) {
+        return -1;
+      }
+    } else if (ParseValue(arg, "--target=", value)) {
+      if (local_config->SelectTestDir(value) != 0) {
+        return -1;
+      }
+    } else if (ParseValue(arg, "--worker=", value)) {
+      unsigned worker = 0;
+      try {
+        worker = static_cast<unsigned>(std::stoul(value));
+      } catch (const std::exception &) {
+        std::cerr << "Invalid worker number: " << value << std::endl;
+        return -1;
+      }
+
+      if (local_config->SetWorker(worker) != 0) {
+        return -1;
+      }
+    } else if (arg == "--list-footprints") {
+      list_footprints_ = true;
+    } else if (ParseValue(arg, "--start-after=", value)) {
+      start_after_ = value;
+    } else if (ParseValue(arg, "--skip-tests-file=", value)) {
+      skip_tests_file_ = value;
+    } else if (ParseValue(arg, "--shard-range=", value)) {
+      if (!ParseRange(value, range_begin_, range_end_)) {
+        std::cerr << "Invalid shard range: " << value
+                  << "\nExpected: <begin>:[<end>]" << std::endl;
+        return -1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+int TestRunner::SelectTests(std::vector<std::string> &tests) const {
+  size_t begin = range_begin_;
+  size_t end = std::min(range_end_, tests.size());
+
+  if (!start_after_.empty()) {
+    auto it = std::find(tests.begin(), tests.end(), start_after_);
+
+    if (it == tests.end()) {
+      std::cerr << "Test " << start_after_ << " is not selected to run"
+                << std::endl;
+      return -1;
+    }
+
+    begin = std::max(begin, static_cast<size_t>(it - tests.begin()) + 1);
+  }
+
+  begin = std::min(begin, end);
+  std::vector<std::string> selected(tests.begin() + begin,
+                                    tests.begin() + end);
+
+  if (!skip_tests_file_.empty()) {
+    std::set<std::string> skipped;
+
+    if (ReadTestNames(skip_tests_file_, skipped) != 0) {
+      return -1;
+    }
+
+    selected.erase(std::remove_if(selected.begin(), selected.end(),
+                                  [&skipped](const std::string &test) {
+                                    return skipped.count(test) != 0;
+                                  }),
+                   selected.end());
+  }
+
+  if (selected.size() == tests.size()) {
+    return 0;
+  }
+
+  /* negative patterns would shift tests between shards */
+  if (getenv("GTEST_TOTAL_SHARDS") != nullptr) {
+    std::cerr << "Test range or skipped tests cannot be selected together "
+                 "with gtest sharding"
+              << std::endl;
+    return -1;
+  }
+
+  ::testing::GTEST_FLAG(filter) = test_selection::BuildFilter(selected);
+  tests = selected;
+
+  return 0;
+}
+
+int TestRunner::Run() {
+  if (!targets_.empty() && !::testing::GTEST_FLAG(list_tests) &&
+      !list_footprints_) {
+    TargetComparison target_comparison{targets_};
+    return target_comparison.Run(binary_, args_);
+  }
+
+  std::vector<std::string> tests = test_selection::GetSelectedTests();
+
+  if (SelectTests(tests) != 0) {
+    return -1;
+  }
+
+  if (list_footprints_) {
+    Footprint::List(tests, std::cout);
+    return 0;
+  }
+
+  EventStream *events = nullptr;
+
+  if (!events_file_.empty() && !::testing::GTEST_FLAG(list_tests)) {
+    events = new EventStream();
+    ::testing::UnitTest::GetInstance()->listeners().Append(events);
+
+    if (events->Open(events_file_) != 0) {
+      return -1;
+    }
+  }
+
+  if (test_timeout_ != 0 && !::testing::GTEST_FLAG(list_tests)) {
+    ::testing::UnitTest::GetInstance()->listeners().Append(
+        new Watchdog(test_timeout_));
+  }
+
+  if (!fork_server_ || ::testing::GTEST_FLAG(list_tests)) {
+    return RUN_ALL_TESTS();
+  }
+
+#ifdef __linux__
+  ForkServer fork_server{fork_batch_size_, events,
+                         XmlReport::GetOutputPath(binary_)};
+  return fork_server.Run(tests);
+#else
+  std::cerr << "Fork server mode is supported only on Linux" << std::endl;
+  return -1;
+#endif  // __linux__
+}
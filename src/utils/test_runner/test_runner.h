@@ -0,0 +1,70 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_TEST_RUNNER_TEST_RUNNER_H_
+#define PMDK_TESTS_SRC_UTILS_TEST_RUNNER_TEST_RUNNER_H_
+
+#include <string>
+#include <vector>
+#include "non_copyable/non_copyable.h"
+
+/*
+ * TestRunner -- handles pmdk-tests specific command line options and runs
+ * tests selected with gtest flags accordingly. Arguments have to be parsed
+ * before ::testing::InitGoogleTest(), so that test directory is selected
+ * before test parameters are generated.
+ */
+class TestRunner final : NonCopyable {
+ private:
+  bool fork_server_ = false;
+  unsigned fork_batch_size_ = 1;
+  std::string start_after_;
+  size_t range_begin_ = 0;
+  size_t range_end_ = static_cast<size_t>(-1);
+  std::string skip_tests_file_;
+  std::string events_file_;
+  unsigned test_timeout_ = 0;
+  bool list_footprints_ = false;
+  std::vector<std::string> targets_;
+  std::string binary_;
+  std::vector<std::string> args_;
+
+  int ParseTargets(const std::string &value);
+
+  int SelectTests(std::vector<std::string> &tests) const;
+
+ public:
+  int ParseArguments(int argc, char **argv);
+  int Run();
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_TEST_RUNNER_TEST_RUNNER_H_
@@ -0,0 +1,287 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_selection.h"
+#include <fcntl.h>
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <set>
+#include "gtest/gtest.h"
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+using TestPredicate = std::function<bool(const std::string &name)>;
+
+#ifdef _WIN32
+int SilenceStdout() {
+  fflush(stdout);
+  int saved = _dup(_fileno(stdout));
+  int null_fd = _open("NUL", _O_WRONLY);
+
+  if (null_fd != -1) {
+    _dup2(null_fd, _fileno(stdout));
+    _close(null_fd);
+  }
+
+  return saved;
+}
+
+void RestoreStdout(int saved) {
+  fflush(stdout);
+
+  if (saved != -1) {
+    _dup2(saved, _fileno(stdout));
+    _close(saved);
+  }
+}
+#else
+int SilenceStdout() {
+  fflush(stdout);
+  int saved = dup(STDOUT_FILENO);
+  int null_fd = open("/dev/null", O_WRONLY);
+
+  if (null_fd != -1) {
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+  }
+
+  return saved;
+}
+
+void RestoreStdout(int saved) {
+  fflush(stdout);
+
+  if (saved != -1) {
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+  }
+}
+#endif  // _WIN32
+
+/*
+ * FilterTests -- makes gtest apply its filter, disabled tests handling and
+ * sharding to registered tests, which sets TestInfo::should_run(). In list
+ * mode gtest returns right after that, without running any test.
+ */
+int FilterTests() {
+  const bool list_tests = ::testing::GTEST_FLAG(list_tests);
+  ::testing::GTEST_FLAG(list_tests) = true;
+
+  int saved = SilenceStdout();
+  int ret = RUN_ALL_TESTS();
+  RestoreStdout(saved);
+
+  ::testing::GTEST_FLAG(list_tests) = list_tests;
+
+  return ret;
+}
+
+std::string GetFullName(const ::testing::TestInfo &test_info) {
+  return std::string(test_info.test_case_name()) + "." + test_info.name();
+}
+
+/*
+ * GetParamIndex -- returns index of parameter of test named "Test/N" and
+ * stores "Test" in family, returns -1 for other tests.
+ */
+long long GetParamIndex(const std::string &name, std::string &family) {
+  size_t slash = name.rfind('/');
+
+  if (slash == std::string::npos || slash + 1 == name.size() ||
+      !std::all_of(name.begin() + slash + 1, name.end(),
+                   [](char c) { return c >= '0' && c <= '9'; })) {
+    return -1;
+  }
+
+  family = name.substr(0, slash);
+  return std::stoll(name.substr(slash + 1));
+}
+
+void AppendPattern(std::string &patterns, const std::string &pattern) {
+  if (!patterns.empty()) {
+    patterns += ":";
+  }
+  patterns += pattern;
+}
+
+/*
+ * AppendIndexPatterns -- appends patterns matching decimal numbers from
+ * range [first, last) following prefix. Range is split into blocks of
+ * numbers sharing all but trailing digits, each matched with '?'.
+ */
+void AppendIndexPatterns(std::string &patterns, const std::string &prefix,
+                         long long first, long long last) {
+  while (first < last) {
+    long long block = 1;
+    size_t wildcards = 0;
+
+    while ((first != 0 || block == 1) && first % (block * 10) == 0 &&
+           first + block * 10 <= last) {
+      block *= 10;
+      ++wildcards;
+    }
+
+    const std::string number = std::to_string(first);
+    AppendPattern(patterns,
+                  prefix + number.substr(0, number.size() - wildcards) +
+                      std::string(wildcards, '?'));
+    first += block;
+  }
+}
+
+/*
+ * AppendTestCasePatterns -- appends patterns matching tests of test case for
+ * which is_matched returns true.
+ */
+void AppendTestCasePatterns(std::string &patterns,
+                            const ::testing::TestCase &test_case,
+                            const TestPredicate &is_matched) {
+  const std::string case_name = test_case.name();
+  const int count = test_case.total_test_count();
+  int matched = 0;
+
+  for (int i = 0; i < count; ++i) {
+    matched += is_matched(GetFullName(*test_case.GetTestInfo(i))) ? 1 : 0;
+  }
+
+  if (matched == 0) {
+    return;
+  }
+
+  if (matched == count) {
+    AppendPattern(patterns, case_name + ".*");
+    return;
+  }
+
+  int i = 0;
+  while (i < count) {
+    const std::string name = test_case.GetTestInfo(i)->name();
+    std::string family;
+
+    if (GetParamIndex(name, family) == -1) {
+      if (is_matched(case_name + "." + name)) {
+        AppendPattern(patterns, case_name + "." + name);
+      }
+      ++i;
+      continue;
+    }
+
+    /* consecutive runs of matched parameter indices of one test */
+    const std::string prefix = case_name + "." + family + "/";
+    std::string family_patterns;
+    std::string next_family;
+    bool all_matched = true;
+    long long first = -1;
+    long long last = -1;
+
+    for (; i < count; ++i) {
+      const std::string param_name = test_case.GetTestInfo(i)->name();
+      long long index = GetParamIndex(param_name, next_family);
+
+      if (index == -1 || next_family != family) {
+        break;
+      }
+
+      if (!is_matched(case_name + "." + param_name)) {
+        all_matched = false;
+        continue;
+      }
+
+      if (index != last) {
+        AppendIndexPatterns(family_patterns, prefix, first, last);
+        first = index;
+      }
+      last = index + 1;
+    }
+
+    AppendIndexPatterns(family_patterns, prefix, first, last);
+
+    if (all_matched) {
+      AppendPattern(patterns, prefix + "*");
+    } else if (!family_patterns.empty()) {
+      AppendPattern(patterns, family_patterns);
+    }
+  }
+}
+}  // namespace
+
+std::vector<std::string> test_selection::GetSelectedTests() {
+  const ::testing::UnitTest &unit_test = *::testing::UnitTest::GetInstance();
+  std::vector<std::string> tests;
+
+  if (FilterTests() != 0) {
+    return tests;
+  }
+
+  for (int i = 0; i < unit_test.total_test_case_count(); ++i) {
+    const ::testing::TestCase &test_case = *unit_test.GetTestCase(i);
+
+    for (int j = 0; j < test_case.total_test_count(); ++j) {
+      const ::testing::TestInfo &test_info = *test_case.GetTestInfo(j);
+
+      if (test_info.should_run()) {
+        tests.emplace_back(GetFullName(test_info));
+      }
+    }
+  }
+
+  return tests;
+}
+
+std::string test_selection::BuildFilter(const std::vector<std::string> &tests) {
+  const ::testing::UnitTest &unit_test = *::testing::UnitTest::GetInstance();
+  const std::string filter = ::testing::GTEST_FLAG(filter);
+
+  if (tests.empty()) {
+    return "-*";
+  }
+
+  const std::set<std::string> included(tests.begin(), tests.end());
+  TestPredicate is_excluded = [&included](const std::string &name) {
+    return included.count(name) == 0;
+  };
+
+  size_t dash = filter.find('-');
+  std::string negatives =
+      dash == std::string::npos ? "" : filter.substr(dash + 1);
+
+  for (int i = 0; i < unit_test.total_test_case_count(); ++i) {
+    AppendTestCasePatterns(negatives, *unit_test.GetTestCase(i), is_excluded);
+  }
+
+  return filter.substr(0, dash) + "-" + negatives;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_TEST_RUNNER_TEST_SELECTION_H_
+#define PMDK_TESTS_SRC_UTILS_TEST_RUNNER_TEST_SELECTION_H_
+
+#include <string>
+#include <vector>
+
+namespace test_selection {
+/*
+ * GetSelectedTests -- returns full names of all tests that will be run
+ * according to current gtest flags and sharding environment variables, in
+ * registration order. Tests are selected by gtest itself, running in list
+ * mode with its output discarded.
+ */
+std::vector<std::string> GetSelectedTests();
+
+/*
+ * BuildFilter -- extends current gtest filter, so that out of selected tests
+ * it matches only given ones. Other tests are excluded with negative
+ * patterns: whole test cases with single wildcard pattern, parameterized
+ * tests of partially excluded test case by decimal ranges of their
+ * parameter indices (e.g. "Case.Test/1??"). Length of the filter depends on
+ * number of test cases and of runs of consecutive excluded parameters, not
+ * on number of excluded tests.
+ */
+std::string BuildFilter(const std::vector<std::string> &tests);
+}  // namespace test_selection
+
+#endif  // !PMDK_TESTS_SRC_UTILS_TEST_RUNNER_TEST_SELECTION_H_
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "watchdog.h"
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include "shell/i_shell.h"
+
+Watchdog::~Watchdog() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_one();
+
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void Watchdog::Watch() {
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  while (!stop_) {
+    if (test_.empty()) {
+      cv_.wait(lock);
+    } else if (cv_.wait_until(lock, deadline_) == std::cv_status::timeout &&
+               !test_.empty() &&
+               std::chrono::steady_clock::now() >= deadline_) {
+      std::cout << "\n[ TIMEOUT  ] " << test_ << " exceeded its budget of "
+                << budget_.count() << " seconds" << std::endl;
+      fflush(stdout);
+      IShell::KillRunningCommands();
+      std::_Exit(WATCHDOG_EXIT_CODE);
+    }
+  }
+}
+
+void Watchdog::OnTestStart(const ::testing::TestInfo &test_info) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    test_ = std::string(test_info.test_case_name()) + "." + test_info.name();
+    deadline_ = std::chrono::steady_clock::now() + budget_;
+  }
+  cv_.notify_one();
+
+  if (!thread_.joinable()) {
+    thread_ = std::thread(&Watchdog::Watch, this);
+  }
+}
+
+void Watchdog::OnTestEnd(const ::testing::TestInfo &) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    test_.clear();
+  }
+  cv_.notify_one();
+}
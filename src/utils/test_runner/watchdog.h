@@ -0,0 +1,75 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_TEST_RUNNER_WATCHDOG_H_
+#define PMDK_TESTS_SRC_UTILS_TEST_RUNNER_WATCHDOG_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "gtest/gtest.h"
+
+const int WATCHDOG_EXIT_CODE = 124;
+
+/*
+ * Watchdog -- enforces time budget of each test. When test exceeds its
+ * budget, commands spawned by the test are killed and the binary terminates,
+ * so execution can be resumed with the next test. Watching thread is started
+ * with the first test, hence the watchdog also works in children forked
+ * from the fork server.
+ */
+class Watchdog final : public ::testing::EmptyTestEventListener {
+ private:
+  std::chrono::seconds budget_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread thread_;
+  std::string test_;
+  std::chrono::steady_clock::time_point deadline_;
+  bool stop_ = false;
+
+  void Watch();
+
+ public:
+  explicit Watchdog(unsigned budget) : budget_(budget) {
+  }
+  Watchdog(const Watchdog &) = delete;
+  Watchdog &operator=(const Watchdog &) = delete;
+  ~Watchdog();
+
+  void OnTestStart(const ::testing::TestInfo &test_info) override;
+  void OnTestEnd(const ::testing::TestInfo &test_info) override;
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_TEST_RUNNER_WATCHDOG_H_
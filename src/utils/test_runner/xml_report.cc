@@ -0,0 +1,192 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "xml_report.h"
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+
+namespace {
+const char *const COUNTERS[] = {"tests", "failures", "disabled", "errors"};
+
+pugi::xml_attribute GetAttribute(pugi::xml_node &node, const char *name) {
+  pugi::xml_attribute attribute = node.attribute(name);
+
+  return attribute ? attribute : node.append_attribute(name);
+}
+
+/* same format as used by gtest */
+std::string FormatSeconds(double seconds) {
+  std::ostringstream stream;
+  stream << std::fixed << std::setprecision(3) << seconds;
+  return stream.str();
+}
+
+void AddTime(pugi::xml_node &node, double seconds) {
+  pugi::xml_attribute time = GetAttribute(node, "time");
+  time.set_value(FormatSeconds(time.as_double() + seconds).c_str());
+}
+
+void AddCounters(pugi::xml_node &node, const pugi::xml_node &other) {
+  for (const char *counter : COUNTERS) {
+    pugi::xml_attribute attribute = GetAttribute(node, counter);
+    attribute.set_value(attribute.as_int() +
+                        other.attribute(counter).as_int());
+  }
+  AddTime(node, other.attribute("time").as_double());
+}
+
+void Increment(pugi::xml_node &node, const char *counter) {
+  pugi::xml_attribute attribute = GetAttribute(node, counter);
+  attribute.set_value(attribute.as_int() + 1);
+}
+}  // namespace
+
+XmlReport::XmlReport() {
+  root_ = report_.append_child("testsuites");
+  AddCounters(root_, pugi::xml_node());
+  root_.append_attribute("name") = "AllTests";
+}
+
+std::string XmlReport::GetOutputPath(const std::string &binary) {
+  using ::testing::internal::FilePath;
+
+  /* mirrors UnitTestOptions::GetAbsolutePathToOutputFile() of gtest */
+  const std::string &output = ::testing::GTEST_FLAG(output);
+  const size_t colon = output.find(':');
+
+  if (output.substr(0, colon) != "xml") {
+    return "";
+  }
+
+  const FilePath working_dir(
+      ::testing::UnitTest::GetInstance()->original_working_dir());
+
+  if (colon == std::string::npos) {
+    return FilePath::ConcatPaths(working_dir, FilePath("test_detail.xml"))
+        .string();
+  }
+
+  FilePath path(output.substr(colon + 1));
+  if (!path.IsAbsolutePath()) {
+    path = FilePath::ConcatPaths(working_dir, path);
+  }
+
+  if (!path.IsDirectory()) {
+    return path.string();
+  }
+
+  FilePath name = FilePath(binary).RemoveDirectoryName();
+#ifdef _WIN32
+  name = name.RemoveExtension("exe");
+#endif  // _WIN32
+
+  return FilePath::GenerateUniqueFileName(path, name, "xml").string();
+}
+
+pugi::xml_node XmlReport::GetSuite(const std::string &name) {
+  pugi::xml_node suite =
+      root_.find_child_by_attribute("testsuite", "name", name.c_str());
+
+  if (!suite) {
+    suite = root_.append_child("testsuite");
+    suite.append_attribute("name") = name.c_str();
+    AddCounters(suite, pugi::xml_node());
+  }
+
+  return suite;
+}
+
+int XmlReport::Append(const std::string &path) {
+  pugi::xml_document part;
+
+  if (!part.load_file(path.c_str())) {
+    std::cerr << "Cannot parse test report " << path << std::endl;
+    return -1;
+  }
+
+  pugi::xml_node root = part.child("testsuites");
+  if (!root_.attribute("timestamp")) {
+    root_.insert_attribute_before("timestamp", root_.attribute("time")) =
+        root.attribute("timestamp").value();
+  }
+  AddCounters(root_, root);
+
+  for (pugi::xml_node suite : root.children("testsuite")) {
+    pugi::xml_node merged = GetSuite(suite.attribute("name").value());
+    AddCounters(merged, suite);
+
+    for (pugi::xml_node test : suite.children("testcase")) {
+      merged.append_copy(test);
+    }
+  }
+
+  return 0;
+}
+
+void XmlReport::AddTest(const std::string &test, long long time_ms,
+                        const std::string &failure) {
+  const size_t dot = test.find('.');
+  const std::string suite_name = test.substr(0, dot);
+  const double seconds = static_cast<double>(time_ms) / 1000;
+  pugi::xml_node suite = GetSuite(suite_name);
+
+  pugi::xml_node testcase = suite.append_child("testcase");
+  testcase.append_attribute("name") = test.substr(dot + 1).c_str();
+  testcase.append_attribute("status") = "run";
+  testcase.append_attribute("time") = FormatSeconds(seconds).c_str();
+  testcase.append_attribute("classname") = suite_name.c_str();
+
+  for (pugi::xml_node node : {root_, suite}) {
+    Increment(node, "tests");
+    AddTime(node, seconds);
+    if (!failure.empty()) {
+      Increment(node, "failures");
+    }
+  }
+
+  if (!failure.empty()) {
+    pugi::xml_node node = testcase.append_child("failure");
+    node.append_attribute("message") = failure.c_str();
+    node.append_attribute("type") = "";
+  }
+}
+
+int XmlReport::Save(const std::string &path) const {
+  if (!report_.save_file(path.c_str(), "  ")) {
+    std::cerr << "Cannot save test report " << path << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_TEST_RUNNER_XML_REPORT_H_
+#define PMDK_TESTS_SRC_UTILS_TEST_RUNNER_XML_REPORT_H_
+
+#include <string>
+#include "non_copyable/non_copyable.h"
+#include "pugixml.hpp"
+
+/*
+ * XmlReport -- joins gtest XML reports written by separate processes (e.g.
+ * fork server children, each running a batch of tests) into a single
+ * report. Test suites of the same name are merged and their counters are
+ * summed. Tests which did not get into any report, because process running
+ * them terminated prematurely, can be added explicitly.
+ */
+class XmlReport final : NonCopyable {
+ private:
+  pugi::xml_document report_;
+  pugi::xml_node root_;
+
+  pugi::xml_node GetSuite(const std::string &name);
+
+ public:
+  XmlReport();
+
+  /*
+   * GetOutputPath -- returns path of XML report requested with
+   * --gtest_output, as chosen by gtest at initialization, or empty string
+   * if XML report was not requested.
+   */
+  static std::string GetOutputPath(const std::string &binary);
+
+  int Append(const std::string &path);
+  void AddTest(const std::string &test, long long time_ms,
+               const std::string &failure);
+  int Save(const std::string &path) const;
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_TEST_RUNNER_XML_REPORT_H_
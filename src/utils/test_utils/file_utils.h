@@ -33,26 +33,57 @@
 #ifndef PMDK_TESTS_SRC_UTILS_TEST_UTILS_FILE_UTILS_H_
 #define PMDK_TESTS_SRC_UTILS_TEST_UTILS_FILE_UTILS_H_
 
+#include <libpmempool.h>
 #include <string>
 #include "api_c/api_c.h"
 #include "constants.h"
 #include "poolset/poolset.h"
 #include "poolset/poolset_management.h"
+#include "timer/timer.h"
 
 namespace file_utils {
-static inline size_t GetSize(std::string size) {
-  std::array<std::string, 9> suffix = {"KiB", "MiB", "GiB", "KB", "MB",
-                                       "GB",  "K",   "M",   "G"};
-  size_t pos;
-  for (const auto &suf : suffix) {
-    if ((pos = size.find(suf)) != std::string::npos) {
-      size.erase(pos);
-
-      return static_cast<size_t>(std::stoul(size)) * SIZES.at(suf);
-    }
+static inline size_t GetSize(const std::string &size) {
+  return ParseSize(size);
+}
+
+static inline size_t GetPoolsetSize(const Poolset &poolset) {
+  size_t size = 0;
+  for (const auto &part : poolset.GetReplica(0).GetParts()) {
+    size += GetSize(part.GetSize());
+  }
+
+  return size;
+}
+
+/*
+ * GetPartsSize -- returns summed size of parts of all replicas, i.e. space
+ * taken by pool described by poolset.
+ */
+static inline size_t GetPartsSize(const Poolset &poolset) {
+  size_t size = 0;
+  for (const auto &part : poolset.GetParts()) {
+    size += GetSize(part.GetSize());
   }
 
-  return static_cast<size_t>(std::stoul(size));
+  return size;
+}
+
+/*
+ * ValidateAllocation -- makes sure that file has all of its size allocated,
+ * i.e. it is neither sparse nor partially allocated.
+ */
+static inline int ValidateAllocation(const std::string &path,
+                                     size_t file_size) {
+  long long allocated = ApiC::GetAllocatedSize(path);
+
+  if (allocated < static_cast<long long>(file_size)) {
+    std::cerr << "File is not fully allocated\n" << path
+              << "\nExpected: " << file_size << "\nActual: " << allocated
+              << std::endl;
+    return -1;
+  }
+
+  return 0;
 }
 
 static inline int ValidatePoolset(const Poolset &poolset, int poolset_mode) {
@@ -63,15 +94,29 @@ static inline int ValidatePoolset(const Poolset &poolset, int poolset_mode) {
     return -1;
   }
 
+  std::vector<Part> parts = poolset.GetParts();
+  std::vector<std::string> paths;
+  for (const auto &part : parts) {
+    paths.emplace_back(part.GetPath());
+  }
+
+  std::vector<long long> sizes = ApiC::GetFilesSize(paths);
+  if (sizes.size() != parts.size()) {
+    return -1;
+  }
+
   int ret = 0;
   size_t size = 0;
-  for (const auto &part : poolset.GetParts()) {
-    size = ApiC::GetFileSize(part.GetPath());
+  for (size_t i = 0; i < parts.size(); ++i) {
+    const Part &part = parts[i];
+    size = static_cast<size_t>(sizes[i]);
     if (GetSize(part.GetSize()) != size) {
       std::cerr << "Part's size mismatch\n" << part.GetPath()
                 << "\nExpected: " << part.GetSize() << "\nActual: " << size
                 << std::endl;
       ret = -1;
+    } else if (ValidateAllocation(part.GetPath(), size) != 0) {
+      ret = -1;
     }
   }
 
@@ -93,6 +138,52 @@ static inline int ValidatePoolset(const Poolset &poolset, int poolset_mode) {
   return ret;
 }
 
+/*
+ * CompareReplicas -- compares parts of given replica with corresponding parts
+ * of master replica, skipping part headers which differ between replicas.
+ * Offset of the first mismatching byte within replica (counted from the
+ * beginning of its first part) is stored in mismatch_offset, -1 if content
+ * of replicas is the same.
+ */
+static inline int CompareReplicas(const Poolset &poolset, unsigned replica,
+                                  long long &mismatch_offset) {
+  const size_t PART_HDR_SIZE = 4 * KIBIBYTE;
+  const std::vector<Part> &master = poolset.GetReplica(0).GetParts();
+  const std::vector<Part> &parts = poolset.GetReplica(replica).GetParts();
+
+  if (master.size() != parts.size()) {
+    std::cerr << "Replicas have different number of parts" << std::endl;
+    return -1;
+  }
+
+  long long part_offset = 0;
+  mismatch_offset = -1;
+
+  for (size_t i = 0; i < parts.size() && mismatch_offset == -1; ++i) {
+    long long size = ApiC::GetFileSize(master[i].GetPath());
+
+    if (size < static_cast<long long>(PART_HDR_SIZE) ||
+        size != ApiC::GetFileSize(parts[i].GetPath())) {
+      std::cerr << "Part's size mismatch\n" << parts[i].GetPath()
+                << std::endl;
+      return -1;
+    }
+
+    if (ApiC::CompareFileRegions(master[i].GetPath(), PART_HDR_SIZE,
+                                 parts[i].GetPath(), PART_HDR_SIZE,
+                                 size - PART_HDR_SIZE, mismatch_offset) != 0) {
+      return -1;
+    }
+
+    if (mismatch_offset != -1) {
+      mismatch_offset += part_offset + PART_HDR_SIZE;
+    }
+    part_offset += size;
+  }
+
+  return 0;
+}
+
 static inline int ValidateFile(const std::string &path, size_t file_size,
                                int file_mode) {
   if (!ApiC::RegularFileExists(path)) {
@@ -109,6 +200,10 @@ static inline int ValidateFile(const std::string &path, size_t file_size,
     return -1;
   }
 
+  if (ValidateAllocation(path, file_size) != 0) {
+    return -1;
+  }
+
   int ret = 0;
   int mode = 0;
   mode = ApiC::GetFilePermission(path);
@@ -121,6 +216,57 @@ static inline int ValidateFile(const std::string &path, size_t file_size,
 
   return ret;
 }
+
+/*
+ * CheckConsistency -- runs in-process libpmempool consistency check on pool
+ * or poolset file. With repair_dry_run set, check also reports whether found
+ * issues are repairable, without modifying the pool. Time spent on checking
+ * is stored in check_time_us.
+ */
+static inline int CheckConsistency(const std::string &path,
+                                   long long &check_time_us,
+                                   bool repair_dry_run = false) {
+  struct pmempool_check_args args;
+  args.path = path.c_str();
+  args.backup_path = nullptr;
+  args.pool_type = PMEMPOOL_POOL_TYPE_DETECT;
+  args.flags = PMEMPOOL_CHECK_FORMAT_STR;
+
+  if (repair_dry_run) {
+    args.flags |= PMEMPOOL_CHECK_REPAIR | PMEMPOOL_CHECK_DRY_RUN |
+                  PMEMPOOL_CHECK_ALWAYS_YES;
+  }
+
+  Timer timer;
+  timer.Start();
+
+  PMEMpoolcheck *ppc = pmempool_check_init(&args, sizeof(args));
+
+  if (ppc == nullptr) {
+    std::cerr << "Unable to initialize check: " << pmempool_errormsg()
+              << std::endl;
+    return -1;
+  }
+
+  struct pmempool_check_status *status = nullptr;
+  while ((status = pmempool_check(ppc)) != nullptr) {
+    if (status->type == PMEMPOOL_CHECK_MSG_TYPE_ERROR) {
+      std::cerr << status->str.msg << std::endl;
+    }
+  }
+
+  enum pmempool_check_result result = pmempool_check_end(ppc);
+  timer.Stop();
+  check_time_us = timer.GetElapsed();
+
+  if (result != PMEMPOOL_CHECK_RESULT_CONSISTENT) {
+    std::cerr << "Pool is not consistent\n" << path
+              << "\nCheck result: " << result << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
 }
 
 #endif  // !PMDK_TESTS_SRC_UTILS_TEST_UTILS_FILE_UTILS_H_
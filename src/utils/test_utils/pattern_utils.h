@@ -0,0 +1,214 @@
+/*
+ * Copyright 2018, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_TEST_UTILS_PATTERN_UTILS_H_
+#define PMDK_TESTS_SRC_UTILS_TEST_UTILS_PATTERN_UTILS_H_
+
+#include <libpmem.h>
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include "api_c/api_c.h"
+#include "constants.h"
+
+/*
+ * Pattern is derived from seed and offset of each 8-byte word, so any range
+ * of data can be generated and verified independently of the others, by
+ * multiple threads at once.
+ */
+namespace pattern_utils {
+/* size of range filled or verified by a thread at a time */
+static const size_t CHUNK_SIZE = 4 * MEBIBYTE;
+static const size_t PATTERN_BLOCK_SIZE = 64 * KIBIBYTE;
+
+static inline uint64_t GetWord(uint64_t seed, uint64_t index) {
+  /* splitmix64 finalizer of seed mixed with word index */
+  uint64_t z = seed + (index + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+/* GenerateBlock -- writes pattern of range starting at offset to buffer */
+static inline void GenerateBlock(char *buffer, size_t offset, size_t length,
+                                 uint64_t seed) {
+  size_t index = offset / sizeof(uint64_t);
+  size_t skip = offset % sizeof(uint64_t);
+
+  for (size_t done = 0; done < length; ++index) {
+    uint64_t word = GetWord(seed, index);
+    size_t count = std::min(sizeof(uint64_t) - skip, length - done);
+    memcpy(buffer + done, reinterpret_cast<char *>(&word) + skip, count);
+    done += count;
+    skip = 0;
+  }
+}
+
+static inline unsigned GetThreadsCount(unsigned threads) {
+  return threads != 0 ? threads
+                      : std::max(1u, std::thread::hardware_concurrency());
+}
+
+/*
+ * ForEachChunk -- runs function for each chunk of range of given length in
+ * threads, which take consecutive chunks until the whole range is done.
+ */
+template <typename Function>
+static inline void ForEachChunk(size_t length, unsigned threads,
+                                Function function) {
+  std::atomic<size_t> next{0};
+  std::vector<std::thread> workers;
+
+  for (unsigned i = 0; i < GetThreadsCount(threads); ++i) {
+    workers.emplace_back([&]() {
+      size_t chunk;
+      while ((chunk = next.fetch_add(CHUNK_SIZE)) < length) {
+        function(chunk, std::min(CHUNK_SIZE, length - chunk));
+      }
+    });
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+/*
+ * Fill -- fills range with pattern derived from seed. With persist set,
+ * data is stored with pmem_memcpy_persist on persistent memory and flushed
+ * with pmem_msync otherwise. Number of threads 0 means one per CPU.
+ */
+static inline int Fill(char *addr, size_t length, uint64_t seed,
+                       unsigned threads = 0, bool persist = true) {
+  bool is_pmem = persist && pmem_is_pmem(addr, length) != 0;
+  std::atomic<int> ret{0};
+
+  ForEachChunk(length, threads, [&](size_t chunk, size_t chunk_length) {
+    std::vector<char> buffer(PATTERN_BLOCK_SIZE);
+
+    for (size_t offset = chunk; offset < chunk + chunk_length;
+         offset += PATTERN_BLOCK_SIZE) {
+      size_t block_length =
+          std::min(PATTERN_BLOCK_SIZE, chunk + chunk_length - offset);
+      GenerateBlock(buffer.data(), offset, block_length, seed);
+
+      if (is_pmem) {
+        pmem_memcpy_persist(addr + offset, buffer.data(), block_length);
+      } else {
+        memcpy(addr + offset, buffer.data(), block_length);
+      }
+    }
+
+    if (persist && !is_pmem && pmem_msync(addr + chunk, chunk_length) != 0) {
+      ret = -1;
+    }
+  });
+
+  return ret;
+}
+
+/*
+ * Verify -- compares range with pattern derived from seed. Returns offset of
+ * the first mismatching byte or -1 if the whole range matches.
+ */
+static inline long long Verify(const char *addr, size_t length,
+                               uint64_t seed, unsigned threads = 0) {
+  std::atomic<long long> mismatch{-1};
+
+  ForEachChunk(length, threads, [&](size_t chunk, size_t chunk_length) {
+    std::vector<char> buffer(PATTERN_BLOCK_SIZE);
+
+    for (size_t offset = chunk; offset < chunk + chunk_length;
+         offset += PATTERN_BLOCK_SIZE) {
+      size_t block_length =
+          std::min(PATTERN_BLOCK_SIZE, chunk + chunk_length - offset);
+      GenerateBlock(buffer.data(), offset, block_length, seed);
+
+      long long found =
+          ApiC::CompareMemory(addr + offset, buffer.data(), block_length);
+      if (found == -1) {
+        continue;
+      }
+
+      /* keep the lowest offset, chunks are verified out of order */
+      long long current = mismatch.load();
+      found += static_cast<long long>(offset);
+      while ((current == -1 || found < current) &&
+             !mismatch.compare_exchange_weak(current, found)) {
+      }
+      return;
+    }
+  });
+
+  return mismatch;
+}
+
+/* FillFile -- fills whole existing file with pattern and persists it */
+static inline int FillFile(const std::string &path, uint64_t seed,
+                           unsigned threads = 0) {
+  size_t mapped_len = 0;
+  int is_pmem = 0;
+  char *addr = static_cast<char *>(
+      pmem_map_file(path.c_str(), 0, 0, 0, &mapped_len, &is_pmem));
+
+  if (addr == nullptr) {
+    std::cerr << "Unable to map file: " << pmem_errormsg() << std::endl;
+    return -1;
+  }
+
+  int ret = Fill(addr, mapped_len, seed, threads);
+  pmem_unmap(addr, mapped_len);
+
+  return ret;
+}
+
+/* VerifyFile -- verifies pattern of whole file */
+static inline int VerifyFile(const std::string &path, uint64_t seed,
+                             long long &mismatch_offset,
+                             unsigned threads = 0) {
+  MappedFile file;
+
+  if (file.Map(path) != 0) {
+    return -1;
+  }
+
+  mismatch_offset = Verify(file.GetData(), file.GetSize(), seed, threads);
+
+  return 0;
+}
+}  // namespace pattern_utils
+
+#endif  // !PMDK_TESTS_SRC_UTILS_TEST_UTILS_PATTERN_UTILS_H_